@@ -0,0 +1,203 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#ifdef STATIC_COLLECTIONS_BENCH_BOOST
+#include <boost/circular_buffer.hpp>
+#endif
+
+#include "cyclecounter.hpp"
+#include "leakguard/circularbuffer.hpp"
+
+namespace {
+
+constexpr std::size_t CAPACITY = 1024;
+constexpr std::size_t ODD_CAPACITY = 1000;
+constexpr std::size_t SPSC_BLOCK = 64;
+
+/**
+ * @brief Gives lg::CircularBuffer and boost::circular_buffer a common interface
+ */
+template <typename T, std::size_t size>
+struct StaticAdapter {
+    lg::CircularBuffer<T, size> buffer;
+
+    bool Push(const T& value) noexcept
+    {
+        return buffer.PushOne(value);
+    }
+
+    bool Pop(T& out) noexcept
+    {
+        return buffer.PeekAndPop(out);
+    }
+
+    std::size_t PushMany(std::span<const T> values) noexcept
+    {
+        return buffer.PushMany(values);
+    }
+
+    std::size_t PopMany(T* out, std::size_t count) noexcept
+    {
+        return buffer.PopInto(out, count);
+    }
+};
+
+#ifdef STATIC_COLLECTIONS_BENCH_BOOST
+template <typename T, std::size_t size>
+struct BoostAdapter {
+    boost::circular_buffer<T> buffer { size };
+
+    bool Push(const T& value)
+    {
+        if (buffer.full()) {
+            return false;
+        }
+
+        buffer.push_back(value);
+        return true;
+    }
+
+    bool Pop(T& out)
+    {
+        if (buffer.empty()) {
+            return false;
+        }
+
+        out = buffer.front();
+        buffer.pop_front();
+        return true;
+    }
+
+    std::size_t PushMany(std::span<const T> values)
+    {
+        const std::size_t count = std::min(values.size(), buffer.reserve());
+        buffer.insert(buffer.end(), values.begin(), values.begin() + count);
+        return count;
+    }
+
+    std::size_t PopMany(T* out, std::size_t count)
+    {
+        count = std::min(count, buffer.size());
+        std::copy_n(buffer.begin(), count, out);
+        buffer.erase_begin(count);
+        return count;
+    }
+};
+#endif
+
+template <typename Adapter>
+void BM_PushPop(benchmark::State& state)
+{
+    Adapter adapter;
+    std::uint32_t value = 0;
+
+    for (auto _ : state) {
+        adapter.Push(value);
+        adapter.Pop(value);
+        benchmark::DoNotOptimize(value);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Adapter>
+void BM_PushManyPopMany(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::uint8_t> input(count, 0x55);
+    std::vector<std::uint8_t> output(count);
+    Adapter adapter;
+
+    for (auto _ : state) {
+        adapter.PushMany(input);
+        adapter.PopMany(output.data(), count);
+        benchmark::DoNotOptimize(output.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+
+/**
+ * @brief Measures every push and pop separately, reporting percentiles
+ *        of a cycle counter histogram instead of a mean
+ */
+template <typename Adapter>
+void BM_PushPopLatency(benchmark::State& state)
+{
+    Adapter adapter;
+    lg::bench::LatencyHistogram push;
+    lg::bench::LatencyHistogram pop;
+    std::uint32_t value = 0;
+
+    for (auto _ : state) {
+        std::uint64_t start = lg::bench::ReadCycleCounter();
+        adapter.Push(value);
+        push.Record(lg::bench::CyclesSince(start));
+
+        start = lg::bench::ReadCycleCounter();
+        adapter.Pop(value);
+        pop.Record(lg::bench::CyclesSince(start));
+
+        benchmark::DoNotOptimize(value);
+    }
+
+    state.counters["push_p50"] = static_cast<double>(push.GetPercentile(50));
+    state.counters["push_p99"] = static_cast<double>(push.GetPercentile(99));
+    state.counters["push_max"] = static_cast<double>(push.GetMax());
+    state.counters["pop_p50"] = static_cast<double>(pop.GetPercentile(50));
+    state.counters["pop_p99"] = static_cast<double>(pop.GetPercentile(99));
+    state.counters["pop_max"] = static_cast<double>(pop.GetMax());
+}
+
+/**
+ * @brief Moves blocks from a producer thread to a consumer thread through
+ *        a lock-free SpscRingBuffer
+ *
+ * Both threads run the same number of iterations, one block each, so
+ * the buffer is empty again when the benchmark ends.
+ */
+void BM_SpscTransfer(benchmark::State& state)
+{
+    static lg::SpscRingBuffer<std::uint32_t, CAPACITY> buffer;
+    std::array<std::uint32_t, SPSC_BLOCK> block {};
+
+    for (auto _ : state) {
+        std::size_t done = 0;
+
+        if (state.thread_index() == 0) {
+            while (done < block.size()) {
+                done += buffer.PushMany(std::span<const std::uint32_t>(block).subspan(done));
+            }
+        } else {
+            while (done < block.size()) {
+                done += buffer.PopInto(block.data() + done, block.size() - done);
+            }
+        }
+
+        benchmark::DoNotOptimize(block.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(block.size()));
+}
+
+}
+
+BENCHMARK(BM_PushPop<StaticAdapter<std::uint32_t, CAPACITY>>);
+BENCHMARK(BM_PushPop<StaticAdapter<std::uint32_t, ODD_CAPACITY>>);
+BENCHMARK(BM_PushManyPopMany<StaticAdapter<std::uint8_t, CAPACITY>>)->RangeMultiplier(4)->Range(16, 1024);
+BENCHMARK(BM_PushManyPopMany<StaticAdapter<std::uint8_t, ODD_CAPACITY>>)->RangeMultiplier(4)->Range(16, 1000);
+BENCHMARK(BM_PushPopLatency<StaticAdapter<std::uint32_t, CAPACITY>>);
+BENCHMARK(BM_SpscTransfer)->Threads(2)->UseRealTime();
+
+#ifdef STATIC_COLLECTIONS_BENCH_BOOST
+BENCHMARK(BM_PushPop<BoostAdapter<std::uint32_t, CAPACITY>>);
+BENCHMARK(BM_PushManyPopMany<BoostAdapter<std::uint8_t, CAPACITY>>)->RangeMultiplier(4)->Range(16, 1024);
+BENCHMARK(BM_PushPopLatency<BoostAdapter<std::uint32_t, CAPACITY>>);
+#endif
@@ -0,0 +1,66 @@
+# Prints the code size of every lg:: class instantiation in an object file,
+# summed over its member functions, e.g.
+#   cmake -DNM=nm -DOBJECT=codesize.cpp.o -P codesize.cmake
+
+if(NOT NM OR NOT OBJECT)
+    message(FATAL_ERROR "usage: cmake -DNM=<nm> -DOBJECT=<object file> -P codesize.cmake")
+endif()
+
+execute_process(
+    COMMAND ${NM} -C --size-sort --radix=d ${OBJECT}
+    OUTPUT_VARIABLE symbols
+    RESULT_VARIABLE result)
+
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${NM} failed on ${OBJECT}")
+endif()
+
+string(REPLACE ";" "\\;" symbols "${symbols}")
+string(REPLACE "\n" ";" symbols "${symbols}")
+
+set(classes)
+set(total 0)
+
+foreach(line IN LISTS symbols)
+    # Only code: "<size> <t|T|w|W> <name>"
+    if(NOT line MATCHES "^([0-9]+) [tTwW] (.*)$")
+        continue()
+    endif()
+
+    set(size ${CMAKE_MATCH_1})
+    set(name "${CMAKE_MATCH_2}")
+
+    # The class is everything up to the first "::" after the template
+    # arguments, which never nest in the instantiations measured here
+    if(NOT name MATCHES "^[^(]*(lg::[A-Za-z]+(<[^>]*>)?)::")
+        continue()
+    endif()
+
+    set(class "${CMAKE_MATCH_1}")
+    if(class STREQUAL "lg::bench")
+        continue()
+    endif()
+
+    string(MAKE_C_IDENTIFIER "${class}" key)
+
+    if(NOT DEFINED size_${key})
+        list(APPEND classes "${class}")
+        set(size_${key} 0)
+        set(count_${key} 0)
+    endif()
+
+    math(EXPR size_${key} "${size_${key}} + ${size}")
+    math(EXPR count_${key} "${count_${key}} + 1")
+    math(EXPR total "${total} + ${size}")
+endforeach()
+
+list(SORT classes)
+
+foreach(class IN LISTS classes)
+    string(MAKE_C_IDENTIFIER "${class}" key)
+    string(LENGTH "${size_${key}}" width)
+    string(SUBSTRING "        " ${width} -1 padding)
+    message("${padding}${size_${key}} bytes in ${count_${key}} functions  ${class}")
+endforeach()
+
+message("total: ${total} bytes")
@@ -0,0 +1,56 @@
+#include <cstddef>
+#include <cstdint>
+
+#include "leakguard/staticstring.hpp"
+#include "leakguard/staticvector.hpp"
+
+/*
+ * Not a benchmark, but the input of the static_collections_size_report
+ * target. It instantiates the containers at several capacities, so that
+ * the report shows how much code each additional capacity costs and how much
+ * is shared by all of them. The member function templates are instantiated
+ * through the noinline functions below the explicit instantiations.
+ */
+
+template class lg::StaticString<8>;
+template class lg::StaticString<16>;
+template class lg::StaticString<32>;
+template class lg::StaticString<64>;
+template class lg::StaticString<300>;
+
+template class lg::StaticVector<std::uint32_t, 8>;
+template class lg::StaticVector<std::uint32_t, 16>;
+template class lg::StaticVector<std::uint32_t, 32>;
+template class lg::StaticVector<std::uint32_t, 64>;
+template class lg::StaticVector<std::uint32_t, 300>;
+
+namespace lg::bench {
+
+template <std::size_t size>
+[[gnu::noinline]] bool ExerciseString(StaticString<size>& string, std::int32_t value) noexcept
+{
+    return string.AppendNumber(value) && string.AppendNumber(static_cast<std::uint64_t>(value), 16);
+}
+
+template <std::size_t size>
+[[gnu::noinline]] std::size_t ExerciseVector(
+    StaticVector<std::uint32_t, size>& vector, const std::uint32_t* values, std::size_t count) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    vector.AppendRange(values, values + count);
+    return vector.RemoveValue(values[0]);
+}
+
+template bool ExerciseString(StaticString<8>&, std::int32_t) noexcept;
+template bool ExerciseString(StaticString<16>&, std::int32_t) noexcept;
+template bool ExerciseString(StaticString<32>&, std::int32_t) noexcept;
+template bool ExerciseString(StaticString<64>&, std::int32_t) noexcept;
+template bool ExerciseString(StaticString<300>&, std::int32_t) noexcept;
+
+template std::size_t ExerciseVector(StaticVector<std::uint32_t, 8>&, const std::uint32_t*, std::size_t) noexcept;
+template std::size_t ExerciseVector(StaticVector<std::uint32_t, 16>&, const std::uint32_t*, std::size_t) noexcept;
+template std::size_t ExerciseVector(StaticVector<std::uint32_t, 32>&, const std::uint32_t*, std::size_t) noexcept;
+template std::size_t ExerciseVector(StaticVector<std::uint32_t, 64>&, const std::uint32_t*, std::size_t) noexcept;
+template std::size_t ExerciseVector(StaticVector<std::uint32_t, 300>&, const std::uint32_t*, std::size_t) noexcept;
+
+};
@@ -0,0 +1,126 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+
+#include "cyclecounter.hpp"
+#include "leakguard/circularbuffer.hpp"
+#include "leakguard/staticstring.hpp"
+#include "leakguard/staticvector.hpp"
+
+/*
+ * A benchmark runner without dependencies beyond the standard library and
+ * printf(), which also fits on a microcontroller. Every operation is timed
+ * separately with the cycle counter and the latencies are summarized as
+ * percentiles. To run it from firmware, compile this file with
+ * STATIC_COLLECTIONS_BENCH_NO_MAIN defined and call lg::bench::RunCycleBenchmarks()
+ * once stdout is retargeted.
+ */
+
+namespace lg::bench {
+
+namespace {
+
+constexpr std::size_t SAMPLES = 1000;
+constexpr std::size_t BLOCK = 64;
+
+/**
+ * @brief Keeps the compiler from optimizing away a value or the code
+ *        computing it
+ */
+template <typename T>
+void Keep(const T& value) noexcept
+{
+#if defined(__GNUC__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+template <typename Operation>
+void Measure(const char* name, Operation operation) noexcept
+{
+    LatencyHistogram histogram;
+
+    for (std::size_t i = 0; i < SAMPLES; ++i) {
+        const std::uint64_t start = ReadCycleCounter();
+        operation();
+        histogram.Record(CyclesSince(start));
+    }
+
+    std::printf("%-32s %8llu %8llu %8llu %8llu\n", name,
+        static_cast<unsigned long long>(histogram.GetMin()),
+        static_cast<unsigned long long>(histogram.GetPercentile(50)),
+        static_cast<unsigned long long>(histogram.GetPercentile(99)),
+        static_cast<unsigned long long>(histogram.GetMax()));
+}
+
+}
+
+/**
+ * @brief Runs all cycle counter benchmarks and prints the results
+ */
+void RunCycleBenchmarks() noexcept
+{
+    EnableCycleCounter();
+    std::printf("%-32s %8s %8s %8s %8s\n", "operation", "min", "p50", "p99", "max");
+
+    Measure("(measurement overhead)", [] {});
+
+    static CircularBuffer<std::uint8_t, 256> buffer;
+    std::uint8_t value = 0;
+
+    Measure("CircularBuffer PushOne", [&] {
+        buffer.PushOne(value);
+        Keep(buffer);
+    });
+    Measure("CircularBuffer PeekAndPop", [&] {
+        buffer.PeekAndPop(value);
+        Keep(value);
+    });
+
+    static std::array<std::uint8_t, BLOCK> block {};
+    Measure("CircularBuffer PushMany 64", [&] {
+        buffer.PushMany(std::span<const std::uint8_t>(block));
+        Keep(buffer);
+    });
+    Measure("CircularBuffer PopInto 64", [&] {
+        buffer.PopInto(block.data(), block.size());
+        Keep(block);
+    });
+
+    static StaticVector<std::uint32_t, 64> vector;
+    Measure("StaticVector Append", [&] {
+        if (!vector.Append(value)) {
+            vector.Clear();
+        }
+        Keep(vector);
+    });
+    Measure("StaticVector Insert front", [&] {
+        if (!vector.Insert(0, value)) {
+            vector.Clear();
+        }
+        Keep(vector);
+    });
+
+    const StaticString<64> sentence("The quick brown fox jumps over the lazy dog.");
+    const StaticString<64> copy(sentence);
+    Measure("StaticString operator==", [&] { Keep(sentence == copy); });
+    Measure("StaticString Of", [&] { Keep(StaticString<16>::Of(-1234567890)); });
+
+    const StaticString<16> number("-1234567890");
+    Measure("StaticString Parse", [&] { Keep(number.Parse<std::int32_t>()); });
+}
+
+};
+
+#ifndef STATIC_COLLECTIONS_BENCH_NO_MAIN
+int main()
+{
+    lg::bench::RunCycleBenchmarks();
+    return 0;
+}
+#endif
@@ -0,0 +1,185 @@
+#pragma once
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif !defined(__ARM_ARCH_7M__) && !defined(__ARM_ARCH_7EM__) \
+    && !defined(__ARM_ARCH_8M_MAIN__) && !defined(__ARM_ARCH_8_1M_MAIN__)
+#include <chrono>
+#endif
+
+namespace lg::bench {
+
+/**
+ * @brief Whether the cycle counter is the Cortex-M DWT CYCCNT register
+ */
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) \
+    || defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__)
+inline constexpr bool USES_DWT_CYCCNT = true;
+#else
+inline constexpr bool USES_DWT_CYCCNT = false;
+#endif
+
+/**
+ * @brief Starts the cycle counter, if it has to be started at all
+ *
+ * On Cortex-M, this enables the trace unit and the DWT cycle counter.
+ * Elsewhere, it does nothing.
+ */
+inline void EnableCycleCounter() noexcept
+{
+    if constexpr (USES_DWT_CYCCNT) {
+        // NOLINTBEGIN(*-reinterpret-cast, performance-no-int-to-ptr)
+        auto& demcr = *reinterpret_cast<volatile std::uint32_t*>(0xE000EDFC);
+        auto& dwtLock = *reinterpret_cast<volatile std::uint32_t*>(0xE0001FB0);
+        auto& dwtControl = *reinterpret_cast<volatile std::uint32_t*>(0xE0001000);
+        auto& dwtCycles = *reinterpret_cast<volatile std::uint32_t*>(0xE0001004);
+        // NOLINTEND(*-reinterpret-cast, performance-no-int-to-ptr)
+
+        demcr = demcr | (1U << 24); // TRCENA
+        dwtLock = 0xC5ACCE55; // unlocks DWT on Cortex-M7, ignored elsewhere
+        dwtCycles = 0;
+        dwtControl = dwtControl | 1U; // CYCCNTENA
+    }
+}
+
+/**
+ * @brief Reads the cycle counter
+ *
+ * Uses DWT CYCCNT on Cortex-M, which wraps every 2^32 cycles, and rdtsc on
+ * x86, which counts reference cycles at a constant rate. Other platforms
+ * fall back to std::chrono::steady_clock and count nanoseconds.
+ *
+ * @return the current counter value
+ */
+inline std::uint64_t ReadCycleCounter() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    if constexpr (USES_DWT_CYCCNT) {
+        // NOLINTNEXTLINE(*-reinterpret-cast, performance-no-int-to-ptr)
+        return *reinterpret_cast<volatile std::uint32_t*>(0xE0001004);
+    } else {
+        return static_cast<std::uint64_t>(
+            std::chrono::steady_clock::now().time_since_epoch().count());
+    }
+#endif
+}
+
+/**
+ * @brief Gets the number of cycles elapsed since an earlier counter value,
+ *        accounting for the 32-bit DWT counter wrapping around
+ *
+ * @param start the earlier counter value
+ * @return the number of cycles elapsed
+ */
+inline std::uint64_t CyclesSince(std::uint64_t start) noexcept
+{
+    const std::uint64_t now = ReadCycleCounter();
+
+    if constexpr (USES_DWT_CYCCNT) {
+        return static_cast<std::uint32_t>(now - start);
+    } else {
+        return now - start;
+    }
+}
+
+/**
+ * @brief A histogram of latencies with power-of-two buckets, using only
+ *        statically allocated memory
+ *
+ * The n-th bucket counts samples in [2^(n-1), 2^n), so percentiles have
+ * a resolution of a factor of two, while recording a sample costs one
+ * count-leading-zeros instruction and one increment.
+ */
+class LatencyHistogram {
+public:
+    /**
+     * @brief Records a sample
+     *
+     * @param cycles the measured latency
+     */
+    void Record(std::uint64_t cycles) noexcept
+    {
+        ++m_buckets[static_cast<size_t>(std::bit_width(cycles))];
+        ++m_count;
+        m_min = cycles < m_min ? cycles : m_min;
+        m_max = cycles > m_max ? cycles : m_max;
+    }
+
+    /**
+     * @brief Gets an upper bound of a percentile
+     *
+     * @param percentile the percentile, from 0 to 100
+     * @return the upper bound of the bucket containing the percentile,
+     *         clamped to the largest sample
+     */
+    [[nodiscard]] std::uint64_t GetPercentile(double percentile) const noexcept
+    {
+        const auto rank = static_cast<std::uint64_t>(static_cast<double>(m_count) * percentile / 100.0);
+        std::uint64_t seen = 0;
+
+        for (size_t bucket = 0; bucket < m_buckets.size(); ++bucket) {
+            seen += m_buckets[bucket];
+
+            if (seen > rank) {
+                const std::uint64_t upper = bucket == 0 ? 0 : (std::uint64_t { 1 } << bucket) - 1;
+                return upper < m_max ? upper : m_max;
+            }
+        }
+
+        return m_max;
+    }
+
+    /**
+     * @brief Gets the number of samples recorded
+     *
+     * @return the number of samples
+     */
+    [[nodiscard]] std::uint64_t GetCount() const noexcept
+    {
+        return m_count;
+    }
+
+    /**
+     * @brief Gets the smallest sample
+     *
+     * @return the smallest sample, or 0 if there are none
+     */
+    [[nodiscard]] std::uint64_t GetMin() const noexcept
+    {
+        return m_count == 0 ? 0 : m_min;
+    }
+
+    /**
+     * @brief Gets the largest sample
+     *
+     * @return the largest sample, or 0 if there are none
+     */
+    [[nodiscard]] std::uint64_t GetMax() const noexcept
+    {
+        return m_max;
+    }
+
+    /**
+     * @brief Forgets all samples
+     */
+    void Clear() noexcept
+    {
+        *this = LatencyHistogram();
+    }
+
+private:
+    static constexpr size_t BUCKET_COUNT = 65;
+
+    std::array<std::uint64_t, BUCKET_COUNT> m_buckets {};
+    std::uint64_t m_count { 0 };
+    std::uint64_t m_min { UINT64_MAX };
+    std::uint64_t m_max { 0 };
+};
+
+};
@@ -0,0 +1,174 @@
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <version>
+
+#ifdef __cpp_lib_format
+#include <format>
+#endif
+
+#include <benchmark/benchmark.h>
+
+#include "leakguard/format.hpp"
+#include "leakguard/staticstring.hpp"
+
+namespace {
+
+constexpr const char* SENTENCE = "The quick brown fox jumps over the lazy dog, twice over.";
+constexpr const char* WORD = "fox ";
+constexpr const char* NUMBER = "-1234567890";
+constexpr std::int32_t VALUE = -1234567890;
+
+void BM_StaticStringCompare(benchmark::State& state)
+{
+    const lg::StaticString<64> lhs(SENTENCE);
+    lg::StaticString<64> rhs(SENTENCE);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rhs);
+        benchmark::DoNotOptimize(lhs == rhs);
+    }
+}
+
+void BM_StdStringCompare(benchmark::State& state)
+{
+    const std::string lhs(SENTENCE);
+    std::string rhs(SENTENCE);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rhs);
+        benchmark::DoNotOptimize(lhs == rhs);
+    }
+}
+
+void BM_StaticStringConcat(benchmark::State& state)
+{
+    for (auto _ : state) {
+        lg::StaticString<64> result;
+        for (int i = 0; i < 16; ++i) {
+            result += WORD;
+        }
+
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+void BM_StdStringConcat(benchmark::State& state)
+{
+    for (auto _ : state) {
+        std::string result;
+        for (int i = 0; i < 16; ++i) {
+            result += WORD;
+        }
+
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+void BM_StaticStringOf(benchmark::State& state)
+{
+    std::int32_t value = VALUE;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(value);
+        benchmark::DoNotOptimize(lg::StaticString<16>::Of(value));
+    }
+}
+
+void BM_StdToString(benchmark::State& state)
+{
+    std::int32_t value = VALUE;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(value);
+        benchmark::DoNotOptimize(std::to_string(value));
+    }
+}
+
+void BM_StaticStringFormat(benchmark::State& state)
+{
+    std::int32_t value = VALUE;
+    const lg::StaticString<8> name("sensor");
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(value);
+        benchmark::DoNotOptimize(lg::Format<"{}: {} (0x{x})">(name, value, value));
+    }
+}
+
+void BM_Snprintf(benchmark::State& state)
+{
+    std::int32_t value = VALUE;
+    char buffer[64]; // NOLINT(*-avoid-c-arrays)
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(value);
+        std::snprintf(buffer, sizeof(buffer), "%s: %d (0x%x)", "sensor", value,
+            static_cast<unsigned>(value));
+        benchmark::DoNotOptimize(buffer);
+    }
+}
+
+#ifdef __cpp_lib_format
+void BM_StdFormat(benchmark::State& state)
+{
+    std::int32_t value = VALUE;
+    const std::string name("sensor");
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(value);
+        benchmark::DoNotOptimize(std::format("{}: {} (0x{:x})", name, value,
+            static_cast<std::uint32_t>(value)));
+    }
+}
+#endif
+
+void BM_StaticStringParse(benchmark::State& state)
+{
+    const lg::StaticString<16> number(NUMBER);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(number);
+        benchmark::DoNotOptimize(number.Parse<std::int32_t>());
+    }
+}
+
+void BM_FromChars(benchmark::State& state)
+{
+    const std::string number(NUMBER);
+
+    for (auto _ : state) {
+        std::int32_t value = 0;
+        benchmark::DoNotOptimize(number);
+        std::from_chars(number.data(), number.data() + number.size(), value);
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+void BM_Stoi(benchmark::State& state)
+{
+    const std::string number(NUMBER);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(number);
+        benchmark::DoNotOptimize(std::stoi(number));
+    }
+}
+
+}
+
+BENCHMARK(BM_StaticStringCompare);
+BENCHMARK(BM_StdStringCompare);
+BENCHMARK(BM_StaticStringConcat);
+BENCHMARK(BM_StdStringConcat);
+BENCHMARK(BM_StaticStringOf);
+BENCHMARK(BM_StdToString);
+BENCHMARK(BM_StaticStringFormat);
+BENCHMARK(BM_Snprintf);
+#ifdef __cpp_lib_format
+BENCHMARK(BM_StdFormat);
+#endif
+BENCHMARK(BM_StaticStringParse);
+BENCHMARK(BM_FromChars);
+BENCHMARK(BM_Stoi);
@@ -0,0 +1,125 @@
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "leakguard/staticvector.hpp"
+
+namespace {
+
+constexpr std::size_t CAPACITY = 256;
+
+/**
+ * @brief Gives lg::StaticVector and std::vector a common interface
+ */
+template <typename T>
+struct StaticAdapter {
+    lg::StaticVector<T, CAPACITY> vector;
+
+    void Append(const T& value) noexcept
+    {
+        vector.Append(value);
+    }
+
+    void Insert(std::size_t index, const T& value) noexcept
+    {
+        vector.Insert(index, value);
+    }
+
+    void Remove(std::size_t index) noexcept
+    {
+        vector.RemoveIndex(index);
+    }
+
+    void Clear() noexcept
+    {
+        vector.Clear();
+    }
+
+    [[nodiscard]] std::size_t GetSize() const noexcept
+    {
+        return vector.GetSize();
+    }
+};
+
+template <typename T>
+struct StdAdapter {
+    std::vector<T> vector = [] {
+        std::vector<T> reserved;
+        reserved.reserve(CAPACITY);
+        return reserved;
+    }();
+
+    void Append(const T& value)
+    {
+        vector.push_back(value);
+    }
+
+    void Insert(std::size_t index, const T& value)
+    {
+        vector.insert(vector.begin() + static_cast<std::ptrdiff_t>(index), value);
+    }
+
+    void Remove(std::size_t index)
+    {
+        vector.erase(vector.begin() + static_cast<std::ptrdiff_t>(index));
+    }
+
+    void Clear()
+    {
+        vector.clear();
+    }
+
+    [[nodiscard]] std::size_t GetSize() const noexcept
+    {
+        return vector.size();
+    }
+};
+
+template <typename Adapter>
+void BM_AppendClear(benchmark::State& state)
+{
+    Adapter adapter;
+
+    for (auto _ : state) {
+        for (std::uint32_t i = 0; i < CAPACITY; ++i) {
+            adapter.Append(i);
+        }
+
+        benchmark::DoNotOptimize(adapter.vector.begin());
+        adapter.Clear();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(CAPACITY));
+}
+
+/**
+ * @brief Inserts and then removes an element at a position given as
+ *        a percentage of a half-full vector, front or middle
+ */
+template <typename Adapter>
+void BM_InsertRemove(benchmark::State& state)
+{
+    Adapter adapter;
+    for (std::uint32_t i = 0; i < CAPACITY / 2; ++i) {
+        adapter.Append(i);
+    }
+
+    const std::size_t index = adapter.GetSize() * static_cast<std::size_t>(state.range(0)) / 100;
+
+    for (auto _ : state) {
+        adapter.Insert(index, 42);
+        adapter.Remove(index);
+        benchmark::DoNotOptimize(adapter.vector.begin());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+}
+
+BENCHMARK(BM_AppendClear<StaticAdapter<std::uint32_t>>);
+BENCHMARK(BM_AppendClear<StdAdapter<std::uint32_t>>);
+BENCHMARK(BM_InsertRemove<StaticAdapter<std::uint32_t>>)->Arg(0)->Arg(50);
+BENCHMARK(BM_InsertRemove<StdAdapter<std::uint32_t>>)->Arg(0)->Arg(50);
@@ -0,0 +1,15 @@
+#pragma once
+#include <cstddef>
+
+namespace lg {
+
+/**
+ * @brief A cache line size suitable for padding and aligning data on most
+ *        x86 and ARM application processors
+ *
+ * std::hardware_destructive_interference_size is not used, as its value
+ * can change with compiler flags and thus break the ABI.
+ */
+inline constexpr std::size_t DEFAULT_CACHE_LINE_SIZE = 64;
+
+};
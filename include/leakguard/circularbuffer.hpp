@@ -1,33 +1,261 @@
 #pragma once
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <iterator>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+#include "cacheline.hpp"
+#include "mutex.hpp"
+#include "sizetype.hpp"
 
 namespace lg {
 
 /**
- * @brief A default implementation of CircularBuffer mutex that does nothing
+ * @brief A snapshot of CircularBuffer usage statistics
+ *
+ * @sa CountingStatsImpl
+ */
+struct CircularBufferStats {
+    /**
+     * @brief The largest number of elements stored at once
+     */
+    std::size_t highWaterMark;
+
+    /**
+     * @brief The total number of elements pushed
+     */
+    std::size_t pushedElements;
+
+    /**
+     * @brief The total number of elements popped
+     */
+    std::size_t poppedElements;
+
+    /**
+     * @brief The number of pushes that did not fit in the buffer entirely
+     */
+    std::size_t rejectedPushes;
+
+    /**
+     * @brief The number of elements lost to OverflowPolicy::OverwriteOldest
+     */
+    std::size_t droppedElements;
+
+    /**
+     * @brief The number of pops that found the buffer empty
+     */
+    std::size_t emptyPops;
+
+    /**
+     * @brief The longest time the mutex was held, in clock ticks
+     */
+    std::uint64_t maxLockHoldTime;
+
+    /**
+     * @brief The total time the mutex was held, in clock ticks
+     */
+    std::uint64_t totalLockHoldTime;
+};
+
+/**
+ * @brief A default implementation of CircularBuffer statistics that
+ *        does nothing
  *
- * It contains an implicitly defined default constructor, as well as two
- * inline member functions that contain no instructions.
+ * All of its member functions are inline and contain no instructions,
+ * so statistics are compiled out entirely.
  *
- * This struct satisfies MutexImpl concept.
+ * This struct satisfies StatsImpl concept.
  */
-struct NopMutexImpl {
+struct NopStatsImpl {
+    /**
+     * @brief Records a push, called by the producer
+     *
+     * This implementation is a no-op and does nothing.
+     *
+     * @param pushed the number of elements pushed
+     * @param rejected whether some elements did not fit in the buffer
+     * @param dropped the number of elements lost to overwriting
+     * @param currentSize the number of elements stored after the push
+     */
+    void OnPush(size_t pushed, bool rejected, size_t dropped, size_t currentSize)
+    {
+        (void)pushed;
+        (void)rejected;
+        (void)dropped;
+        (void)currentSize;
+    }
+
+    /**
+     * @brief Records a pop, called by the consumer
+     *
+     * This implementation is a no-op and does nothing.
+     *
+     * @param popped the number of elements popped, 0 if the buffer was empty
+     */
+    void OnPop(size_t popped)
+    {
+        (void)popped;
+    }
+
     /**
-     * @brief Locks the critical section
+     * @brief Called right after the mutex is locked
      *
      * This implementation is a no-op and does nothing.
      */
-    void Lock() { }
+    void OnLockAcquired() { }
 
     /**
-     * @brief Unlocks the critical section
+     * @brief Called right before the mutex is unlocked
      *
      * This implementation is a no-op and does nothing.
      */
-    void Unlock() { }
+    void OnLockReleased() { }
+};
+
+/**
+ * @brief An implementation of CircularBuffer statistics that counts
+ *        elements and operations
+ *
+ * Each counter has a single writer, the producer or the consumer, so the
+ * counters are updated with plain relaxed loads and stores and there are no
+ * read-modify-write instructions involved. GetSnapshot() may be called from
+ * any context, but the snapshot is not taken atomically as a whole.
+ *
+ * If a clock is provided, the time the mutex is held is measured as well.
+ * The clock has to provide a static `now()` function returning a time point
+ * like std::chrono clocks do, counted in ticks of the clock's duration.
+ *
+ * This class satisfies StatsImpl concept.
+ *
+ * @tparam Clock the clock measuring lock hold time, or void if lock hold
+ *               time should not be measured
+ */
+template <typename Clock = void>
+class CountingStatsImpl {
+public:
+    /**
+     * @brief Records a push, called by the producer
+     *
+     * @param pushed the number of elements pushed
+     * @param rejected whether some elements did not fit in the buffer
+     * @param dropped the number of elements lost to overwriting
+     * @param currentSize the number of elements stored after the push
+     */
+    void OnPush(size_t pushed, bool rejected, size_t dropped, size_t currentSize) noexcept
+    {
+        Increase(m_pushedElements, pushed);
+        Increase(m_rejectedPushes, rejected ? 1 : 0);
+        Increase(m_droppedElements, dropped);
+
+        if (currentSize > m_highWaterMark.load(std::memory_order_relaxed)) {
+            m_highWaterMark.store(currentSize, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Records a pop, called by the consumer
+     *
+     * @param popped the number of elements popped, 0 if the buffer was empty
+     */
+    void OnPop(size_t popped) noexcept
+    {
+        Increase(m_poppedElements, popped);
+        Increase(m_emptyPops, popped == 0 ? 1 : 0);
+    }
+
+    /**
+     * @brief Called right after the mutex is locked
+     */
+    void OnLockAcquired() noexcept
+    {
+        if constexpr (TRACKS_LOCK_TIME) {
+            m_lockAcquireTime = Now();
+        }
+    }
+
+    /**
+     * @brief Called right before the mutex is unlocked
+     */
+    void OnLockReleased() noexcept
+    {
+        if constexpr (TRACKS_LOCK_TIME) {
+            const std::uint64_t holdTime = Now() - m_lockAcquireTime;
+
+            m_totalLockHoldTime += holdTime;
+            m_maxLockHoldTime = std::max(m_maxLockHoldTime, holdTime);
+        }
+    }
+
+    /**
+     * @brief Gets the current values of all counters
+     *
+     * @return the statistics snapshot
+     */
+    [[nodiscard]] CircularBufferStats GetSnapshot() const noexcept
+    {
+        return {
+            .highWaterMark = m_highWaterMark.load(std::memory_order_relaxed),
+            .pushedElements = m_pushedElements.load(std::memory_order_relaxed),
+            .poppedElements = m_poppedElements.load(std::memory_order_relaxed),
+            .rejectedPushes = m_rejectedPushes.load(std::memory_order_relaxed),
+            .droppedElements = m_droppedElements.load(std::memory_order_relaxed),
+            .emptyPops = m_emptyPops.load(std::memory_order_relaxed),
+            .maxLockHoldTime = m_maxLockHoldTime,
+            .totalLockHoldTime = m_totalLockHoldTime,
+        };
+    }
+
+private:
+    static constexpr bool TRACKS_LOCK_TIME = !std::is_void_v<Clock>;
+
+    // Updated by the producer
+    std::atomic<std::size_t> m_highWaterMark { 0 };
+    std::atomic<std::size_t> m_pushedElements { 0 };
+    std::atomic<std::size_t> m_rejectedPushes { 0 };
+    std::atomic<std::size_t> m_droppedElements { 0 };
+
+    // Updated by the consumer
+    std::atomic<std::size_t> m_poppedElements { 0 };
+    std::atomic<std::size_t> m_emptyPops { 0 };
+
+    // Updated while holding the mutex
+    std::uint64_t m_lockAcquireTime { 0 };
+    std::uint64_t m_maxLockHoldTime { 0 };
+    std::uint64_t m_totalLockHoldTime { 0 };
+
+    static std::uint64_t Now() noexcept
+    {
+        return static_cast<std::uint64_t>(Clock::now().time_since_epoch().count());
+    }
+
+    static void Increase(std::atomic<std::size_t>& counter, size_t value) noexcept
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value,
+            std::memory_order_relaxed);
+    }
+};
+
+/**
+ * @brief Specifies what CircularBuffer does when an element is pushed
+ *        into a full buffer
+ */
+enum class OverflowPolicy {
+    /**
+     * @brief The new element is rejected and the push reports a short count
+     */
+    Reject,
+
+    /**
+     * @brief The oldest element is dropped to make room for the new one
+     */
+    OverwriteOldest,
 };
 
 /**
@@ -35,25 +263,82 @@ struct NopMutexImpl {
  *        (a.k.a. ring buffer), which is an efficient implementation of FIFO
  *        queue
  *
- * Only the types that are trivial, or have at least a non-deleted trivial
- * destructor, should be used with this implementation of circular buffer.
- * For performance reasons, elements will never be deleted from the ring
- * buffer. Only overwriting will ever occur. That may cause a severe delay
- * between 'popping' an element from the container and calling its destructor.
+ * The storage is left uninitialized, so T doesn't have to be default
+ * constructible. An element is constructed in place when it is pushed and
+ * destroyed as soon as it is popped, overwritten, cleared, or the buffer
+ * itself is destroyed. For trivially destructible types, destroying is free,
+ * and trivially copyable types are still copied in and out with memcpy().
+ *
+ * The buffer is a lock-free single-producer/single-consumer queue. The producer
+ * (PushMany(), PushOne(), operator<<()) owns the write index and the consumer
+ * (Pop(), PopMany(), PeekAndPop(), Clear(), ...) owns the read index. Each side
+ * publishes its index with a release store and observes the other one with
+ * an acquire load, so there is no shared counter and no mutex is needed
+ * to push from an interrupt and pop from a task. Size getters are exact when
+ * called from the producer or consumer, and only approximate elsewhere.
+ *
+ * If the capacity is a power of two, the indices are counters wrapping at
+ * twice the capacity and masked with `size - 1`, which makes the index math
+ * branchless and lets the buffer use all of its storage. Otherwise one extra
+ * element of storage is needed to tell a full buffer from an empty one.
+ * Either way, the indices are stored in the smallest unsigned type able
+ * to hold them.
+ *
+ * With OverflowPolicy::OverwriteOldest, pushing into a full buffer drops
+ * the oldest elements, so the producer moves the read index as well. In that
+ * mode every operation that moves or reads through the read index is performed
+ * while holding the mutex, which has to actually exclude the other side if
+ * the producer and the consumer run in different contexts. The zero-copy
+ * read regions and iterators are not protected from being overwritten.
+ *
+ * Otherwise, the mutex implementation is only held by Clear(). All mutex
+ * implementations should be copy-constructible or move-constructible.
+ *
+ * A mutex implementation may also provide optional signaling hooks, which
+ * are detected at compile time:
+ * - `NotifyDataAvailable()` is called by the producer when the buffer fills
+ *   up to the high watermark, `WaitDataAvailable()` blocks the consumer in
+ *   WaitForData() until then,
+ * - `NotifySpaceAvailable()` is called by the consumer when the buffer drains
+ *   down to the low watermark, `WaitSpaceAvailable()` blocks the producer in
+ *   WaitForSpace() until then.
+ *
+ * The hooks fire only when a watermark is crossed, not on every operation.
+ * A notification must not get lost if nobody waits yet, i.e. the hooks should
+ * behave like a binary semaphore (e.g. std::binary_semaphore or an RTOS task
+ * notification). A wait hook may return a bool, false meaning a timeout.
  *
- * All mutex implementations should be copy-constructible
- * or move-constructible.
+ * The statistics implementation is notified about every push, every pop
+ * and every time the mutex is held. NopStatsImpl compiles all of it out,
+ * CountingStatsImpl collects a CircularBufferStats snapshot.
+ *
+ * By default, the buffer is laid out compactly, which suits MCUs. If the
+ * producer and the consumer run on different cores, a cache line size can be
+ * provided. The storage, the consumer state and the producer state are then
+ * placed on separate cache lines, and each side keeps a local copy of
+ * the other side's index, so the shared index is only read again when
+ * the local copy shows too little data or space. The copies are not kept with
+ * OverflowPolicy::OverwriteOldest, where both sides move the read index.
  *
  * @sa RingBuffer
+ * @sa SpscRingBuffer
  *
- * @tparam T the type of elements being stored, should be default constructible
+ * @tparam T the type of elements being stored
  * @tparam size buffer capacity
  * @tparam mutexImpl the chosen mutex implementation
+ * @tparam overflowPolicy what happens on a push into a full buffer
+ * @tparam StatsImpl_t the chosen statistics implementation
+ * @tparam cacheLineSize the cache line size to pad the producer and consumer
+ *                       state to, 0 for the compact layout
  */
-template <typename T, std::size_t size, typename MutexImpl_t = NopMutexImpl>
+template <typename T, std::size_t size, typename MutexImpl_t = NopMutexImpl,
+    OverflowPolicy overflowPolicy = OverflowPolicy::Reject,
+    typename StatsImpl_t = NopStatsImpl, std::size_t cacheLineSize = 0>
 class CircularBuffer {
 public:
     static_assert(size > 0, "ring buffer size must be greater than 0");
+    static_assert((cacheLineSize & (cacheLineSize - 1)) == 0,
+        "cache line size must be a power of two");
 
     /**
      * @brief The type Peek() will return, either T or const volatile T&
@@ -90,7 +375,7 @@ public:
          */
         const T& operator*() const
         {
-            return *m_current;
+            return m_buffer[Slot(m_index)];
         }
 
         /**
@@ -100,11 +385,7 @@ public:
          */
         ConstIterator& operator++()
         {
-            ++m_current;
-            if (m_current >= m_end) {
-                m_current = m_begin;
-            }
-
+            m_index = Advance(m_index, 1);
             return *this;
         }
 
@@ -131,7 +412,7 @@ public:
          */
         bool operator==(const ConstIterator& other) const
         {
-            return m_current == other.m_current;
+            return m_index == other.m_index;
         }
 
         /**
@@ -148,17 +429,38 @@ public:
         }
 
     private:
-        ConstIterator(
-            const CircularBuffer<T, size, MutexImpl_t>& instance, const T* current)
-            : m_current(current)
-            , m_begin(instance.m_buffer.begin())
-            , m_end(instance.m_buffer.end())
+        ConstIterator(const CircularBuffer& instance, size_t index)
+            : m_buffer(instance.m_buffer)
+            , m_index(index)
         {
         }
 
-        const T* m_current;
-        const T* m_begin;
-        const T* m_end;
+        const T* m_buffer;
+        size_t m_index;
+    };
+
+    /**
+     * @brief Up to two contiguous blocks of elements currently stored
+     *        in the buffer, in FIFO order
+     *
+     * The second block is non-empty only if the stored elements wrap around
+     * the end of the underlying storage.
+     *
+     * @sa AcquireReadRegions()
+     */
+    struct ReadRegions {
+        std::span<const T> first;
+        std::span<const T> second;
+
+        /**
+         * @brief Gets the total number of elements in both blocks
+         *
+         * @return the number of elements
+         */
+        [[nodiscard]] size_t GetSize() const noexcept
+        {
+            return first.size() + second.size();
+        }
     };
 
     /**
@@ -183,6 +485,22 @@ public:
     {
     }
 
+    /**
+     * @brief Destroys the elements still stored in the buffer
+     */
+    ~CircularBuffer() noexcept
+    {
+        const size_t readPtr = m_readPtr.load(std::memory_order_relaxed);
+        DestroyElements(readPtr, Distance(readPtr, m_writePtr.load(std::memory_order_relaxed)));
+    }
+
+    /**
+     * @brief Trivial destructor for trivially destructible types
+     */
+    ~CircularBuffer() noexcept
+        requires std::is_trivially_destructible<T>::value
+    = default;
+
     ///@}
 
     /**
@@ -209,6 +527,21 @@ public:
         return *this;
     }
 
+    /**
+     * @brief Moves a single element into the circular buffer,
+     *        increasing its size
+     *
+     * @sa PushOne()
+     *
+     * @param value the value to be moved into the buffer
+     * @return reference to self
+     */
+    CircularBuffer& operator<<(T&& value) noexcept
+    {
+        PushOne(std::move(value));
+        return *this;
+    }
+
     /**
      * @brief Retrieves the next element in the circular buffer.
      *
@@ -263,7 +596,8 @@ public:
      */
     [[nodiscard]] size_t GetCurrentSize() const noexcept
     {
-        return m_currentSize;
+        return Distance(m_readPtr.load(std::memory_order_acquire),
+            m_writePtr.load(std::memory_order_acquire));
     }
 
     /**
@@ -274,7 +608,124 @@ public:
      */
     [[nodiscard]] bool IsEmpty() const noexcept
     {
-        return m_currentSize == 0;
+        return m_readPtr.load(std::memory_order_acquire)
+            == m_writePtr.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Gets the usage statistics collected so far
+     *
+     * Only available if the statistics implementation provides
+     * `GetSnapshot()`, e.g. CountingStatsImpl.
+     *
+     * @return the statistics snapshot
+     */
+    [[nodiscard]] CircularBufferStats GetStats() const noexcept
+        requires requires(const StatsImpl_t& stats) { stats.GetSnapshot(); }
+    {
+        return m_stats.GetSnapshot();
+    }
+
+    ///@}
+
+    /**
+     * @name Watermarks and blocking
+     */
+    ///@{
+
+    /**
+     * @brief Sets the number of stored elements at which the consumer
+     *        gets notified, 1 by default
+     *
+     * Only available if the mutex implementation provides
+     * `NotifyDataAvailable()`.
+     *
+     * @param count the high watermark, clamped to [1, size]
+     */
+    void SetHighWatermark(size_t count) noexcept
+        requires HAS_DATA_AVAILABLE_HOOK
+    {
+        m_highWatermark.store(
+            static_cast<MinimalSizeType<size>>(std::clamp<size_t>(count, 1, size)),
+            std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Sets the number of stored elements at which the producer
+     *        gets notified, size - 1 by default
+     *
+     * Only available if the mutex implementation provides
+     * `NotifySpaceAvailable()`.
+     *
+     * @param count the low watermark, clamped to [0, size - 1]
+     */
+    void SetLowWatermark(size_t count) noexcept
+        requires HAS_SPACE_AVAILABLE_HOOK
+    {
+        m_lowWatermark.store(
+            static_cast<MinimalSizeType<size>>(std::min<size_t>(count, size - 1)),
+            std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Blocks the consumer until at least the high watermark number
+     *        of elements is stored in the buffer
+     *
+     * @sa SetHighWatermark()
+     *
+     * @return the number of stored elements, which is below the watermark
+     *         only if waiting timed out
+     */
+    size_t WaitForData() noexcept
+        requires HAS_DATA_AVAILABLE_HOOK
+        && requires(MutexImpl_t& mutex) { mutex.WaitDataAvailable(); }
+    {
+        while (true) {
+            // Pairs with the fence in PublishWrite(), so that either this side
+            // sees the new write index, or the producer notices the crossing
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            const size_t currentSize = GetCurrentSize();
+            if (currentSize >= m_highWatermark.load(std::memory_order_relaxed)) {
+                return currentSize;
+            }
+
+            if constexpr (std::is_void_v<decltype(m_mutexImpl.WaitDataAvailable())>) {
+                m_mutexImpl.WaitDataAvailable();
+            } else if (!m_mutexImpl.WaitDataAvailable()) {
+                return GetCurrentSize();
+            }
+        }
+    }
+
+    /**
+     * @brief Blocks the producer until at most the low watermark number
+     *        of elements is stored in the buffer
+     *
+     * @sa SetLowWatermark()
+     *
+     * @return the number of free elements, which is below
+     *         size - watermark only if waiting timed out
+     */
+    size_t WaitForSpace() noexcept
+        requires HAS_SPACE_AVAILABLE_HOOK
+        && requires(MutexImpl_t& mutex) { mutex.WaitSpaceAvailable(); }
+    {
+        while (true) {
+            // Pairs with the fence in PublishRead()
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            const size_t currentSize = GetCurrentSize();
+            if (currentSize <= m_lowWatermark.load(std::memory_order_relaxed)) {
+                return size - currentSize;
+            }
+
+            if constexpr (std::is_void_v<decltype(m_mutexImpl.WaitSpaceAvailable())>) {
+                m_mutexImpl.WaitSpaceAvailable();
+            } else if (!m_mutexImpl.WaitSpaceAvailable()) {
+                return size - GetCurrentSize();
+            }
+        }
     }
 
     ///@}
@@ -288,44 +739,155 @@ public:
      * @brief Pushes multiple elements into the circular buffer,
      *        increasing its size
      *
+     * If the iterator is contiguous (e.g. a pointer), the elements are copied
+     * in at most two blocks, which for trivially copyable types boils down
+     * to two memcpy() calls.
+     *
      * @tparam It iterator type, must support preincrementation and dereferencing
      * @param begin an iterator to the beginning
      * @param end an iterator to the end
+     * @param dropped set to the number of elements lost to overwriting,
+     *                always 0 with OverflowPolicy::Reject
      * @return the number of elements pushed, which can be less than
      *         the number of elements provided if the buffer is overrun
+     *         and the overflow policy is OverflowPolicy::Reject
      */
     template <typename It>
-    size_t PushMany(It begin, It end) noexcept
+    size_t PushMany(It begin, It end, size_t& dropped) noexcept
     {
         static_assert(std::is_same<std::decay_t<decltype(*begin)>, std::decay_t<T>>::value,
             "The provided iterator does not dereference to type T");
 
-        size_t currentSize = m_currentSize;
+        [[maybe_unused]] auto lock = AcquireOverwriteMutex();
+
+        const size_t oldWritePtr = m_writePtr.load(std::memory_order_relaxed);
+        size_t writePtr = oldWritePtr;
+
+        size_t needed = size;
+        if constexpr (std::contiguous_iterator<It>) {
+            needed = std::min(needed, static_cast<size_t>(end - begin));
+        }
+
+        size_t readPtr = ObserveReadPtr(writePtr, needed);
+        const size_t freeSpace = size - Distance(readPtr, writePtr);
         size_t pushed = 0;
+        bool rejected = false;
+        dropped = 0;
+
+        if constexpr (std::contiguous_iterator<It>) {
+            const T* source = std::to_address(begin);
+            pushed = static_cast<size_t>(end - begin);
+            size_t count = pushed;
+
+            if constexpr (overflowPolicy == OverflowPolicy::OverwriteOldest) {
+                // Only the last `size` elements would survive anyway
+                const size_t skipped = count > size ? count - size : 0;
+                const size_t overwritten = count - skipped > freeSpace
+                    ? count - skipped - freeSpace
+                    : 0;
+
+                source += skipped;
+                count -= skipped;
+                dropped = skipped + overwritten;
+                DestroyElements(readPtr, overwritten);
+                readPtr = Advance(readPtr, overwritten);
+            } else {
+                rejected = count > freeSpace;
+                count = pushed = std::min(freeSpace, count);
+            }
 
-        while (!(begin == end) && currentSize < size) {
-            m_buffer[m_writePtr] = *begin;
+            const size_t firstPart = std::min(count, STORAGE_SIZE - Slot(writePtr));
+            ConstructElements(source, firstPart, &m_buffer[Slot(writePtr)]);
+            ConstructElements(source + firstPart, count - firstPart, m_buffer);
 
-            // incrementation of volatile is deprecated
-            m_writePtr = m_writePtr + 1;
+            writePtr = Advance(writePtr, count);
+        } else if constexpr (overflowPolicy == OverflowPolicy::OverwriteOldest) {
+            while (!(begin == end)) {
+                const size_t full = Distance(readPtr, writePtr) == size ? 1 : 0;
+                DestroyElements(readPtr, full);
+                readPtr = Advance(readPtr, full);
+                dropped += full;
 
-            ++begin;
-            ++currentSize;
-            ++pushed;
+                std::construct_at(&m_buffer[Slot(writePtr)], *begin);
+
+                writePtr = Advance(writePtr, 1);
+                ++begin;
+                ++pushed;
+            }
+        } else {
+            while (!(begin == end) && pushed < freeSpace) {
+                std::construct_at(&m_buffer[Slot(writePtr)], *begin);
 
-            if (m_writePtr > size) {
-                m_writePtr = 0;
+                writePtr = Advance(writePtr, 1);
+                ++begin;
+                ++pushed;
             }
+
+            rejected = !(begin == end);
+        }
+
+        if constexpr (overflowPolicy == OverflowPolicy::OverwriteOldest) {
+            // The read index goes first, so that the size never appears
+            // to exceed the capacity
+            m_readPtr.store(static_cast<IndexType>(readPtr), std::memory_order_release);
         }
 
         if (pushed > 0) {
-            auto lock = AcquireMutex();
-            m_currentSize = m_currentSize + pushed;
+            PublishWrite(oldWritePtr, writePtr);
         }
 
+        m_stats.OnPush(pushed, rejected, dropped, Distance(readPtr, writePtr));
         return pushed;
     }
 
+    /**
+     * @brief Pushes multiple elements into the circular buffer,
+     *        increasing its size
+     *
+     * @tparam It iterator type, must support preincrementation and dereferencing
+     * @param begin an iterator to the beginning
+     * @param end an iterator to the end
+     * @return the number of elements pushed, which can be less than
+     *         the number of elements provided if the buffer is overrun
+     *         and the overflow policy is OverflowPolicy::Reject
+     */
+    template <typename It>
+    size_t PushMany(It begin, It end) noexcept
+    {
+        size_t dropped = 0;
+        return PushMany(begin, end, dropped);
+    }
+
+    /**
+     * @brief Pushes a contiguous block of elements into the circular buffer,
+     *        increasing its size
+     *
+     * @param elements the elements to be placed into the buffer
+     * @param dropped set to the number of elements lost to overwriting,
+     *                always 0 with OverflowPolicy::Reject
+     * @return the number of elements pushed, which can be less than
+     *         the number of elements provided if the buffer is overrun
+     *         and the overflow policy is OverflowPolicy::Reject
+     */
+    size_t PushMany(std::span<const T> elements, size_t& dropped) noexcept
+    {
+        return PushMany(elements.begin(), elements.end(), dropped);
+    }
+
+    /**
+     * @brief Pushes a contiguous block of elements into the circular buffer,
+     *        increasing its size
+     *
+     * @param elements the elements to be placed into the buffer
+     * @return the number of elements pushed, which can be less than
+     *         the number of elements provided if the buffer is overrun
+     *         and the overflow policy is OverflowPolicy::Reject
+     */
+    size_t PushMany(std::span<const T> elements) noexcept
+    {
+        return PushMany(elements.begin(), elements.end());
+    }
+
     /**
      * @brief Pushes a single element into the circular buffer,
      *        increasing its size
@@ -333,7 +895,8 @@ public:
      * @sa operator<<()
      *
      * @param value the value to be placed into the buffer
-     * @return true, if the operation succeeded (buffer wasn't full),
+     * @return true, if the operation succeeded (buffer wasn't full or
+     *         the overflow policy is OverflowPolicy::OverwriteOldest),
      * @return false otherwise
      */
     bool PushOne(const T& value) noexcept
@@ -343,51 +906,97 @@ public:
     }
 
     /**
-     * @brief Returns the next element in the circular buffer
-     *
-     * If the buffer is currently empty, some garbage data may be returned,
-     * but no exception will ever occur.
+     * @brief Moves a single element into the circular buffer,
+     *        increasing its size
      *
-     * @sa PeekType
+     * @sa Emplace()
      *
-     * @return the next element in the buffer
+     * @param value the value to be moved into the buffer
+     * @return true, if the operation succeeded (buffer wasn't full or
+     *         the overflow policy is OverflowPolicy::OverwriteOldest),
+     * @return false otherwise
      */
-    PeekType Peek() const noexcept
+    bool PushOne(T&& value) noexcept
     {
-        return m_buffer[m_readPtr];
+        return Emplace(std::move(value));
     }
 
     /**
-     * @brief Pops the next element in the circular buffer, i.e. removes it
+     * @brief Constructs a single element in place at the end of the circular
+     *        buffer, increasing its size
      *
-     * If you need to also retrieve the element, you may consider calling
-     * PeekAndPop().
-     *
-     * @sa PeekAndPop()
-     *
-     * @return true, if the operation succeeded (there was at least one element
-               in the buffer),
+     * @tparam Args types of the constructor arguments
+     * @param args arguments forwarded to the constructor of T
+     * @return true, if the operation succeeded (buffer wasn't full or
+     *         the overflow policy is OverflowPolicy::OverwriteOldest),
      * @return false otherwise
      */
-    bool Pop() noexcept
+    template <typename... Args>
+    bool Emplace(Args&&... args) noexcept
     {
-        if (IsEmpty())
-            return false;
-
-        // incrementation of volatile is deprecated
-        size_t newReadPtr = m_readPtr + 1;
-
-        if (newReadPtr > size) {
-            newReadPtr = 0;
+        [[maybe_unused]] auto lock = AcquireOverwriteMutex();
+
+        const size_t writePtr = m_writePtr.load(std::memory_order_relaxed);
+        size_t readPtr = ObserveReadPtr(writePtr, 1);
+        size_t dropped = 0;
+
+        if (Distance(readPtr, writePtr) == size) {
+            if constexpr (overflowPolicy == OverflowPolicy::OverwriteOldest) {
+                DestroyElements(readPtr, 1);
+                readPtr = Advance(readPtr, 1);
+                dropped = 1;
+                m_readPtr.store(static_cast<IndexType>(readPtr), std::memory_order_release);
+            } else {
+                m_stats.OnPush(0, true, 0, size);
+                return false;
+            }
         }
 
-        m_readPtr = newReadPtr;
+        std::construct_at(&m_buffer[Slot(writePtr)], std::forward<Args>(args)...);
 
-        auto lock = AcquireMutex();
-        m_currentSize = m_currentSize - 1;
+        PublishWrite(writePtr, Advance(writePtr, 1));
+        m_stats.OnPush(1, false, dropped, Distance(readPtr, writePtr) + 1);
         return true;
     }
 
+    /**
+     * @brief Returns the next element in the circular buffer
+     *
+     * The buffer must not be empty, as its free slots hold no elements.
+     * In DEBUG mode this is checked. To retrieve an element only if there is
+     * one, use PeekAndPop() instead.
+     *
+     * @sa PeekType
+     *
+     * @return the next element in the buffer
+     */
+    PeekType Peek() const noexcept
+    {
+#ifdef NDEBUG
+        if (IsEmpty()) {
+            std::abort();
+        }
+#endif
+        return m_buffer[Slot(m_readPtr.load(std::memory_order_relaxed))];
+    }
+
+    /**
+     * @brief Pops the next element in the circular buffer, i.e. removes it
+     *
+     * If you need to also retrieve the element, you may consider calling
+     * PeekAndPop().
+     *
+     * @sa PeekAndPop()
+     *
+     * @return true, if the operation succeeded (there was at least one element
+               in the buffer),
+     * @return false otherwise
+     */
+    bool Pop() noexcept
+    {
+        return PopMany(1) > 0;
+    }
+
     /**
      * @brief Pops the next n elements in the circular buffer, i.e. removes them
      *
@@ -396,27 +1005,15 @@ public:
      */
     size_t PopMany(size_t count) noexcept
     {
-        if (count > GetCurrentSize()) {
-            count = GetCurrentSize();
-        }
-
-        size_t newReadPtr = m_readPtr + count;
-        if (newReadPtr > size) {
-            newReadPtr -= size;
-        }
-
-        m_readPtr = newReadPtr;
-
-        auto lock = AcquireMutex();
-        m_currentSize = m_currentSize - count;
-        return count;
+        [[maybe_unused]] auto lock = AcquireOverwriteMutex();
+        return PopManyInternal(count);
     }
 
     /**
      * @brief Retrieves the next element in the circular buffer.
      *
-     * If the buffer is empty, the reference provided as an argument
-     * stays untouched.
+     * The element is moved out and then destroyed. If the buffer is empty,
+     * the reference provided as an argument stays untouched.
      *
      * If you need to only drop the value, use Pop().
      *
@@ -431,23 +1028,77 @@ public:
      */
     bool PeekAndPop(T& out) noexcept
     {
-        if (!IsEmpty()) {
-            out = m_buffer[m_readPtr];
-            return Pop();
+        [[maybe_unused]] auto lock = AcquireOverwriteMutex();
+
+        const size_t readPtr = m_readPtr.load(std::memory_order_relaxed);
+        if (readPtr == ObserveWritePtr(readPtr, 1)) {
+            m_stats.OnPop(0);
+            return false;
         }
 
-        return false;
+        out = std::move(m_buffer[Slot(readPtr)]);
+        DestroyElements(readPtr, 1);
+        PublishRead(readPtr, Advance(readPtr, 1));
+        m_stats.OnPop(1);
+        return true;
+    }
+
+    /**
+     * @brief Copies up to n next elements from the circular buffer
+     *        without removing them
+     *
+     * The elements are copied in at most two blocks, which for trivially
+     * copyable types boils down to two memcpy() calls.
+     *
+     * @sa PopInto()
+     *
+     * @param out pointer to an array of at least count elements
+     * @param count the maximum number of elements to copy
+     * @return the number of elements actually copied
+     */
+    size_t PeekMany(T* out, size_t count) const noexcept
+    {
+        [[maybe_unused]] auto lock = AcquireOverwriteMutex();
+        return ReadManyInternal<false>(out, count);
+    }
+
+    /**
+     * @brief Retrieves up to n next elements from the circular buffer
+     *        and removes them
+     *
+     * The elements are moved out, or copied with memcpy() if T is trivially
+     * copyable, and then destroyed.
+     *
+     * @sa PeekMany()
+     *
+     * @param out pointer to an array of at least count elements
+     * @param count the maximum number of elements to retrieve
+     * @return the number of elements actually retrieved
+     */
+    size_t PopInto(T* out, size_t count) noexcept
+    {
+        [[maybe_unused]] auto lock = AcquireOverwriteMutex();
+        return PopManyInternal(ReadManyInternal<true>(out, count));
     }
 
     /**
      * @brief Clears the circular buffer
      *
+     * This function must be called from the consumer side, as it moves
+     * the read index up to the write index.
      */
     void Clear() noexcept
     {
         auto lock = AcquireMutex();
-        m_currentSize = 0;
-        m_readPtr = m_writePtr;
+        const size_t writePtr = m_writePtr.load(std::memory_order_acquire);
+
+        if constexpr (CACHES_INDICES) {
+            m_cachedWritePtr = static_cast<IndexType>(writePtr);
+        }
+
+        const size_t readPtr = m_readPtr.load(std::memory_order_relaxed);
+        DestroyElements(readPtr, Distance(readPtr, writePtr));
+        PublishRead(readPtr, writePtr);
     }
 
     /**
@@ -456,17 +1107,26 @@ public:
      *
      * @tparam size2 capacity of the target buffer
      * @tparam MutexImpl_t2 mutex implementation of the target buffer
+     * @tparam overflowPolicy2 overflow policy of the target buffer
+     * @tparam StatsImpl_t2 statistics implementation of the target buffer
+     * @tparam cacheLineSize2 cache line size of the target buffer
      * @param target the circular buffer that will receive elements
      * @return the number of moved elements
      */
-    template <std::size_t size2, typename MutexImpl_t2>
-    size_t MoveTo(CircularBuffer<T, size2, MutexImpl_t2>& target) noexcept
+    template <std::size_t size2, typename MutexImpl_t2, OverflowPolicy overflowPolicy2,
+        typename StatsImpl_t2, std::size_t cacheLineSize2>
+    size_t MoveTo(CircularBuffer<T, size2, MutexImpl_t2, overflowPolicy2, StatsImpl_t2,
+        cacheLineSize2>& target) noexcept
     {
-        auto beginIt = begin();
-        auto endIt = end();
+        [[maybe_unused]] auto lock = AcquireOverwriteMutex();
+        const ReadRegions regions = AcquireReadRegions();
 
-        size_t count = target.PushMany(beginIt, endIt);
-        return PopMany(count);
+        size_t count = MoveElementsTo(target, regions.first);
+        if (count == regions.first.size()) {
+            count += MoveElementsTo(target, regions.second);
+        }
+
+        return PopManyInternal(count);
     }
 
     /**
@@ -476,7 +1136,7 @@ public:
      */
     ConstIterator begin() const noexcept
     {
-        return ConstIterator(*this, &m_buffer[m_readPtr]);
+        return ConstIterator(*this, m_readPtr.load(std::memory_order_acquire));
     }
 
     /**
@@ -486,61 +1146,919 @@ public:
      */
     ConstIterator end() const noexcept
     {
-        return ConstIterator(*this, &m_buffer[m_writePtr]);
+        return ConstIterator(*this, m_writePtr.load(std::memory_order_acquire));
     }
 
     ///@}
 
-private:
-    std::array<T, size + 1> m_buffer {};
-    volatile std::size_t m_readPtr { 0 };
-    volatile std::size_t m_writePtr { 0 };
-    volatile std::size_t m_currentSize { 0 };
-    mutable MutexImpl_t m_mutexImpl;
+    /**
+     * @name Zero-copy access
+     */
+    ///@{
 
     /**
-     * @brief A RAII wrapper over MutexImpl object
+     * @brief Gets the largest contiguous block of free storage that
+     *        the producer may write to directly, e.g. with DMA
+     *
+     * The elements written become visible to the consumer only after
+     * CommitWrite() is called. The block may be shorter than the total free
+     * space if the free space wraps around the end of the underlying storage,
+     * in which case another call after CommitWrite() returns the remainder.
+     *
+     * This function must be called from the producer side. It is only
+     * available for trivially copyable types, which need no constructor
+     * to be run on the free storage.
+     *
+     * @sa CommitWrite()
+     *
+     * @return a span over free storage, empty if the buffer is full
      */
-    class MutexHolder {
-    public:
-        MutexHolder(MutexImpl_t& mutex)
-            : m_mutex(mutex)
-        {
-            m_mutex.Lock();
+    std::span<T> AcquireWriteRegion() noexcept
+        requires std::is_trivially_copyable<T>::value
+    {
+        const size_t writePtr = m_writePtr.load(std::memory_order_relaxed);
+        const size_t freeSpace = size
+            - Distance(ObserveReadPtr(writePtr, std::min(size, STORAGE_SIZE - Slot(writePtr))), writePtr);
+
+        return { &m_buffer[Slot(writePtr)],
+            std::min(freeSpace, STORAGE_SIZE - Slot(writePtr)) };
+    }
+
+    /**
+     * @brief Publishes elements written to the region returned by
+     *        AcquireWriteRegion()
+     *
+     * @sa AcquireWriteRegion()
+     *
+     * @param count the number of elements written at the beginning of
+     *              the region
+     * @return the number of elements committed, which is less than count
+     *         only if count exceeds the free space
+     */
+    size_t CommitWrite(size_t count) noexcept
+        requires std::is_trivially_copyable<T>::value
+    {
+        const size_t writePtr = m_writePtr.load(std::memory_order_relaxed);
+        const size_t freeSpace = size
+            - Distance(ObserveReadPtr(writePtr, std::min(count, size)), writePtr);
+
+        const bool rejected = count > freeSpace;
+        if (rejected) {
+            count = freeSpace;
         }
 
-        ~MutexHolder()
-        {
-            m_mutex.Unlock();
+        if (count > 0) {
+            PublishWrite(writePtr, Advance(writePtr, count));
         }
 
-        MutexHolder(const MutexHolder&) = delete;
-        MutexHolder(MutexHolder&&) = default;
-        MutexHolder& operator=(const MutexHolder&) = delete;
-        MutexHolder& operator=(MutexHolder&&) = default;
+        m_stats.OnPush(count, rejected, 0, size - freeSpace + count);
+        return count;
+    }
 
-    private:
-        // NOLINTBEGIN(cppcoreguidelines-avoid-const-or-ref-data-members)
-        MutexImpl_t& m_mutex;
-        // NOLINTEND(cppcoreguidelines-avoid-const-or-ref-data-members)
+    /**
+     * @brief Gets the stored elements as up to two contiguous blocks that
+     *        the consumer may read directly, e.g. with DMA or writev()
+     *
+     * The blocks stay valid until ReleaseRead() is called.
+     *
+     * This function must be called from the consumer side.
+     *
+     * @sa ReleaseRead()
+     *
+     * @return the blocks of stored elements, in FIFO order
+     */
+    ReadRegions AcquireReadRegions() const noexcept
+    {
+        return AcquireReadRegionsInternal(size);
+    }
+
+    /**
+     * @brief Releases elements read through AcquireReadRegions(),
+     *        removing them from the buffer
+     *
+     * @sa AcquireReadRegions()
+     *
+     * @param count the number of elements to release
+     * @return the number of elements actually released
+     */
+    size_t ReleaseRead(size_t count) noexcept
+    {
+        return PopMany(count);
+    }
+
+    ///@}
+
+private:
+    /**
+     * @brief Whether the indices are counters wrapping at (2 * size) and
+     *        masked with (size - 1)
+     */
+    static constexpr bool IS_POWER_OF_TWO = (size & (size - 1)) == 0;
+
+    /**
+     * @brief The largest value an index can take
+     */
+    static constexpr size_t MAX_INDEX = IS_POWER_OF_TWO ? 2 * size - 1 : size;
+
+    /**
+     * @brief The smallest unsigned type able to hold an index
+     */
+    using IndexType = MinimalSizeType<MAX_INDEX>;
+
+    /**
+     * @brief Number of elements in the underlying storage
+     */
+    static constexpr size_t STORAGE_SIZE = IS_POWER_OF_TWO ? size : size + 1;
+
+    /**
+     * @brief Whether each side keeps a local copy of the other side's index
+     */
+    static constexpr bool CACHES_INDICES
+        = cacheLineSize != 0 && overflowPolicy == OverflowPolicy::Reject;
+
+    /**
+     * @brief Whether the mutex implementation wants to be notified when
+     *        the high watermark is reached
+     */
+    static constexpr bool HAS_DATA_AVAILABLE_HOOK
+        = requires(MutexImpl_t& mutex) { mutex.NotifyDataAvailable(); };
+
+    /**
+     * @brief Whether the mutex implementation wants to be notified when
+     *        the low watermark is reached
+     */
+    static constexpr bool HAS_SPACE_AVAILABLE_HOOK
+        = requires(MutexImpl_t& mutex) { mutex.NotifySpaceAvailable(); };
+
+    /**
+     * @brief Takes the place of an unused optional member, a distinct type
+     *        for each member, so that none of them takes up any space
+     */
+    template <int id>
+    struct Unused {
+        constexpr Unused(size_t) noexcept { }
     };
 
-    MutexHolder AcquireMutex() const
+    template <int id>
+    using CachedIndex = std::conditional_t<CACHES_INDICES, IndexType, Unused<id>>;
+
+    /**
+     * @brief Alignment of a member starting a new group of state, which is
+     *        its natural alignment in the compact layout
+     */
+    template <typename U>
+    static constexpr size_t STATE_ALIGNMENT = std::max(cacheLineSize, alignof(U));
+
+    // Uninitialized storage, elements are constructed and destroyed in place
+    union {
+        alignas(STATE_ALIGNMENT<T>) T m_buffer[STORAGE_SIZE]; // NOLINT(*-avoid-c-arrays)
+    };
+
+    // Owned by the consumer
+    alignas(STATE_ALIGNMENT<std::atomic<IndexType>>)
+        std::atomic<IndexType> m_readPtr { 0 };
+    [[no_unique_address]] mutable CachedIndex<0> m_cachedWritePtr { 0 };
+
+    // Owned by the producer
+    alignas(STATE_ALIGNMENT<std::atomic<IndexType>>)
+        std::atomic<IndexType> m_writePtr { 0 };
+    [[no_unique_address]] CachedIndex<1> m_cachedReadPtr { 0 };
+
+    alignas(STATE_ALIGNMENT<MutexImpl_t>) [[no_unique_address]] mutable MutexImpl_t m_mutexImpl;
+    [[no_unique_address]] mutable StatsImpl_t m_stats;
+
+    [[no_unique_address]] std::conditional_t<HAS_DATA_AVAILABLE_HOOK,
+        std::atomic<MinimalSizeType<size>>, Unused<2>>
+        m_highWatermark { 1 };
+
+    [[no_unique_address]] std::conditional_t<HAS_SPACE_AVAILABLE_HOOK,
+        std::atomic<MinimalSizeType<size>>, Unused<3>>
+        m_lowWatermark { size - 1 };
+
+    /**
+     * @brief Maps a buffer index to a position in the underlying storage
+     */
+    static constexpr size_t Slot(size_t index) noexcept
     {
-        return MutexHolder(m_mutexImpl);
+        if constexpr (IS_POWER_OF_TWO) {
+            return index & (size - 1);
+        } else {
+            return index;
+        }
     }
-};
 
-/**
- * @brief A shorter, easier to write type alias for CircularBuffer
- *
- * @sa CircularBuffer
- *
- * @tparam T the type of elements being stored, should be default constructible
- * @tparam size buffer capacity
- * @tparam mutexImpl the chosen mutex implementation
+    /**
+     * @brief Advances a buffer index by the given number of elements,
+     *        wrapping it around the end of the buffer
+     */
+    static constexpr size_t Advance(size_t index, size_t count) noexcept
+    {
+        index += count;
+
+        if constexpr (IS_POWER_OF_TWO) {
+            index &= MAX_INDEX;
+        } else {
+            if (index > size) {
+                index -= size + 1;
+            }
+        }
+
+        return index;
+    }
+
+    /**
+     * @brief Computes the number of elements between the read and write index
+     */
+    static constexpr size_t Distance(size_t readPtr, size_t writePtr) noexcept
+    {
+        if constexpr (IS_POWER_OF_TWO) {
+            return (writePtr - readPtr) & MAX_INDEX;
+        } else {
+            return writePtr >= readPtr ? writePtr - readPtr
+                                       : writePtr + size + 1 - readPtr;
+        }
+    }
+
+    /**
+     * @brief Reads the read index on the producer side, which only needs to
+     *        be loaded if the local copy shows less free space than needed
+     */
+    size_t ObserveReadPtr(size_t writePtr, size_t needed) noexcept
+    {
+        if constexpr (CACHES_INDICES) {
+            if (size - Distance(m_cachedReadPtr, writePtr) < needed) {
+                m_cachedReadPtr = m_readPtr.load(std::memory_order_acquire);
+            }
+
+            return m_cachedReadPtr;
+        } else {
+            return m_readPtr.load(std::memory_order_acquire);
+        }
+    }
+
+    /**
+     * @brief Reads the write index on the consumer side, which only needs to
+     *        be loaded if the local copy shows fewer elements than needed
+     */
+    size_t ObserveWritePtr(size_t readPtr, size_t needed) const noexcept
+    {
+        if constexpr (CACHES_INDICES) {
+            if (Distance(readPtr, m_cachedWritePtr) < needed) {
+                m_cachedWritePtr = m_writePtr.load(std::memory_order_acquire);
+            }
+
+            return m_cachedWritePtr;
+        } else {
+            return m_writePtr.load(std::memory_order_acquire);
+        }
+    }
+
+    /**
+     * @brief Publishes a new write index and notifies the consumer,
+     *        if the high watermark has been reached
+     */
+    void PublishWrite(size_t oldWritePtr, size_t newWritePtr) noexcept
+    {
+        m_writePtr.store(static_cast<IndexType>(newWritePtr), std::memory_order_release);
+
+        if constexpr (HAS_DATA_AVAILABLE_HOOK) {
+            // Pairs with the fence in WaitForData()
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            const size_t readPtr = m_readPtr.load(std::memory_order_relaxed);
+            const size_t watermark = m_highWatermark.load(std::memory_order_relaxed);
+
+            if (Distance(readPtr, oldWritePtr) < watermark
+                && Distance(readPtr, newWritePtr) >= watermark) {
+                m_mutexImpl.NotifyDataAvailable();
+            }
+        }
+    }
+
+    /**
+     * @brief Publishes a new read index and notifies the producer,
+     *        if the low watermark has been reached
+     */
+    void PublishRead(size_t oldReadPtr, size_t newReadPtr) noexcept
+    {
+        m_readPtr.store(static_cast<IndexType>(newReadPtr), std::memory_order_release);
+
+        if constexpr (HAS_SPACE_AVAILABLE_HOOK) {
+            // Pairs with the fence in WaitForSpace()
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            const size_t writePtr = m_writePtr.load(std::memory_order_relaxed);
+            const size_t watermark = m_lowWatermark.load(std::memory_order_relaxed);
+
+            if (Distance(oldReadPtr, writePtr) > watermark
+                && Distance(newReadPtr, writePtr) <= watermark) {
+                m_mutexImpl.NotifySpaceAvailable();
+            }
+        }
+    }
+
+    /**
+     * @brief PopMany() without taking the mutex
+     */
+    size_t PopManyInternal(size_t count) noexcept
+    {
+        const size_t readPtr = m_readPtr.load(std::memory_order_relaxed);
+        const size_t available = Distance(readPtr, ObserveWritePtr(readPtr, count));
+
+        if (count > available) {
+            count = available;
+        }
+
+        if (count > 0) {
+            DestroyElements(readPtr, count);
+            PublishRead(readPtr, Advance(readPtr, count));
+        }
+
+        // Popping nothing out of a non-empty buffer is not an empty pop
+        if (count > 0 || available == 0) {
+            m_stats.OnPop(count);
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief AcquireReadRegions() that only loads the write index if fewer
+     *        than the needed number of elements are known to be available
+     */
+    ReadRegions AcquireReadRegionsInternal(size_t needed) const noexcept
+    {
+        const size_t readPtr = m_readPtr.load(std::memory_order_relaxed);
+        const size_t count = Distance(readPtr, ObserveWritePtr(readPtr, needed));
+        const size_t firstPart = std::min(count, STORAGE_SIZE - Slot(readPtr));
+
+        return { { &m_buffer[Slot(readPtr)], firstPart },
+            { m_buffer, count - firstPart } };
+    }
+
+    /**
+     * @brief PeekMany() without taking the mutex, or the read half of PopInto()
+     *        if the elements are moved out
+     */
+    template <bool moveOut>
+    size_t ReadManyInternal(T* out, size_t count) const noexcept
+    {
+        const ReadRegions regions = AcquireReadRegionsInternal(count);
+
+        const size_t firstPart = std::min(count, regions.first.size());
+        const size_t secondPart = std::min(count - firstPart, regions.second.size());
+
+        AssignElements<moveOut>(regions.first.data(), firstPart, out);
+        AssignElements<moveOut>(regions.second.data(), secondPart, out + firstPart);
+
+        return firstPart + secondPart;
+    }
+
+    /**
+     * @brief Pushes a block of stored elements into another buffer,
+     *        moving them unless T is trivially copyable
+     */
+    template <typename Target>
+    static size_t MoveElementsTo(Target& target, std::span<const T> elements) noexcept
+    {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            return target.PushMany(elements);
+        } else {
+            // The elements are owned by this buffer and about to be popped
+            T* source = const_cast<T*>(elements.data()); // NOLINT(*-const-cast)
+            return target.PushMany(std::make_move_iterator(source),
+                std::make_move_iterator(source + elements.size())); // NOLINT(*-pointer-arithmetic)
+        }
+    }
+
+    /**
+     * @brief Copy-constructs a block of elements in uninitialized storage,
+     *        using memcpy() if T allows it
+     */
+    static void ConstructElements(const T* source, size_t count, T* destination) noexcept
+    {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            // an empty span may carry a null pointer, which memcpy() rejects
+            if (count > 0) {
+                std::memcpy(destination, source, count * sizeof(T));
+            }
+        } else {
+            std::uninitialized_copy_n(source, count, destination);
+        }
+    }
+
+    /**
+     * @brief Copies or moves a block of stored elements over initialized ones,
+     *        using memcpy() if T allows it
+     */
+    template <bool moveOut>
+    static void AssignElements(const T* source, size_t count, T* destination) noexcept
+    {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (count > 0) {
+                std::memcpy(destination, source, count * sizeof(T));
+            }
+        } else if constexpr (moveOut) {
+            // Only used by PopInto(), on elements owned by this buffer
+            T* first = const_cast<T*>(source); // NOLINT(*-const-cast)
+            std::move(first, first + count, destination); // NOLINT(*-pointer-arithmetic)
+        } else {
+            std::copy_n(source, count, destination);
+        }
+    }
+
+    /**
+     * @brief Destroys the given number of stored elements starting at
+     *        a buffer index, which is a no-op for trivially destructible T
+     */
+    void DestroyElements(size_t index, size_t count) noexcept
+    {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            const size_t firstPart = std::min(count, STORAGE_SIZE - Slot(index));
+            std::destroy_n(&m_buffer[Slot(index)], firstPart);
+            std::destroy_n(m_buffer, count - firstPart);
+        }
+    }
+
+    /**
+     * @brief A RAII wrapper over MutexImpl object
+     */
+    class MutexHolder {
+    public:
+        MutexHolder(MutexImpl_t& mutex, StatsImpl_t& stats)
+            : m_mutex(mutex)
+            , m_stats(stats)
+        {
+            m_mutex.Lock();
+            m_stats.OnLockAcquired();
+        }
+
+        ~MutexHolder()
+        {
+            m_stats.OnLockReleased();
+            m_mutex.Unlock();
+        }
+
+        MutexHolder(const MutexHolder&) = delete;
+        MutexHolder(MutexHolder&&) = default;
+        MutexHolder& operator=(const MutexHolder&) = delete;
+        MutexHolder& operator=(MutexHolder&&) = default;
+
+    private:
+        // NOLINTBEGIN(cppcoreguidelines-avoid-const-or-ref-data-members)
+        MutexImpl_t& m_mutex;
+        StatsImpl_t& m_stats;
+        // NOLINTEND(cppcoreguidelines-avoid-const-or-ref-data-members)
+    };
+
+    MutexHolder AcquireMutex() const
+    {
+        return MutexHolder(m_mutexImpl, m_stats);
+    }
+
+    /**
+     * @brief An empty stand-in for MutexHolder, used wherever locking
+     *        is not necessary
+     */
+    struct NopMutexHolder { };
+
+    /**
+     * @brief Acquires the mutex only if the producer may move the read index,
+     *        i.e. with OverflowPolicy::OverwriteOldest
+     */
+    auto AcquireOverwriteMutex() const
+    {
+        if constexpr (overflowPolicy == OverflowPolicy::OverwriteOldest) {
+            return AcquireMutex();
+        } else {
+            return NopMutexHolder {};
+        }
+    }
+};
+
+/**
+ * @brief A shorter, easier to write type alias for CircularBuffer
+ *
+ * @sa CircularBuffer
+ *
+ * @tparam T the type of elements being stored
+ * @tparam size buffer capacity
+ * @tparam mutexImpl the chosen mutex implementation
+ * @tparam overflowPolicy what happens on a push into a full buffer
+ * @tparam StatsImpl_t the chosen statistics implementation
+ * @tparam cacheLineSize the cache line size to pad the producer and consumer
+ *                       state to, 0 for the compact layout
+ */
+template <typename T, std::size_t size, typename MutexImpl_t = NopMutexImpl,
+    OverflowPolicy overflowPolicy = OverflowPolicy::Reject,
+    typename StatsImpl_t = NopStatsImpl, std::size_t cacheLineSize = 0>
+using RingBuffer = CircularBuffer<T, size, MutexImpl_t, overflowPolicy, StatsImpl_t, cacheLineSize>;
+
+/**
+ * @brief A type alias for CircularBuffer shared by exactly one producer and
+ *        one consumer, e.g. an interrupt handler and a task
+ *
+ * No mutex is involved, the buffer indices are synchronized using
+ * acquire/release atomics only.
+ *
+ * @sa CircularBuffer
+ *
+ * @tparam T the type of elements being stored
+ * @tparam size buffer capacity
+ */
+template <typename T, std::size_t size>
+using SpscRingBuffer = CircularBuffer<T, size, NopMutexImpl>;
+
+/**
+ * @brief A lock-free, constant sized circular buffer that can be pushed to
+ *        by any number of producers concurrently
+ *
+ * Every slot carries a sequence number telling whether it is ready to be
+ * written or read in the current lap around the buffer (D. Vyukov's bounded
+ * queue). Producers claim slots with a compare-and-swap on the enqueue index
+ * and then publish them through the slot's sequence number, so producers never
+ * wait for each other and a preempted producer only delays consumers of its
+ * own slot. The buffer uses no mutex and no dynamic memory, but it requires
+ * atomic read-modify-write instructions (e.g. ARMv7-M or newer).
+ *
+ * Elements pushed by a single PushMany() call may interleave with elements
+ * pushed by other producers at the same time.
+ *
+ * Like in CircularBuffer, the elements are constructed in place when pushed
+ * and destroyed when popped, so they need not be default constructible.
+ *
+ * @sa MpmcRingBuffer
+ * @sa MpscRingBuffer
+ *
+ * @tparam T the type of elements being stored
+ * @tparam size buffer capacity, must be a power of two greater than 1
+ * @tparam multiConsumer whether there may be more than one consumer as well,
+ *                       a single consumer does not need a compare-and-swap
+ *                       to pop an element
+ */
+template <typename T, std::size_t size, bool multiConsumer = true>
+class MultiProducerCircularBuffer {
+public:
+    // With a single slot, a full and an empty slot share a sequence number
+    static_assert(size > 1, "ring buffer size must be greater than 1");
+    static_assert((size & (size - 1)) == 0, "ring buffer size must be a power of two");
+
+    /**
+     * @name Constructors and destructors
+     */
+    ///@{
+
+    MultiProducerCircularBuffer() noexcept = default;
+
+    /**
+     * @brief Destroys the elements still stored in the buffer
+     *
+     * No producer or consumer may use the buffer concurrently.
+     */
+    ~MultiProducerCircularBuffer() noexcept
+    {
+        const size_t enqueuePos = m_enqueuePos.load(std::memory_order_acquire);
+
+        for (size_t position = m_dequeuePos.load(std::memory_order_relaxed);
+             position != enqueuePos; ++position) {
+            std::destroy_at(&m_cells[position & (size - 1)].value);
+        }
+    }
+
+    /**
+     * @brief Trivial destructor for trivially destructible types
+     */
+    ~MultiProducerCircularBuffer() noexcept
+        requires std::is_trivially_destructible<T>::value
+    = default;
+
+    ///@}
+
+    /**
+     * @name Operators
+     */
+    ///@{
+
+    /**
+     * @brief Pushes a single element into the circular buffer,
+     *        increasing its size
+     *
+     * If you need to ensure that no error occured during this operation,
+     * use PushOne() function.
+     *
+     * @sa PushOne()
+     *
+     * @param value the value to be placed into the buffer
+     * @return reference to self
+     */
+    MultiProducerCircularBuffer& operator<<(const T& value) noexcept
+    {
+        PushOne(value);
+        return *this;
+    }
+
+    /**
+     * @brief Retrieves the next element in the circular buffer.
+     *
+     * If you need to ensure that no error occured during this operation,
+     * use PeekAndPop() function.
+     *
+     * @sa PeekAndPop()
+     *
+     * @param value a reference to the value that will be populated by the
+     *              next element
+     *
+     * @return reference to self
+     */
+    MultiProducerCircularBuffer& operator>>(T& value) noexcept
+    {
+        PeekAndPop(value);
+        return *this;
+    }
+
+    ///@}
+
+    /**
+     * @name Size getters
+     */
+    ///@{
+
+    /**
+     * @brief Gets the total buffer capacity
+     *
+     * @return the total capacity, in elements
+     */
+    [[nodiscard]] constexpr size_t GetCapacity() const noexcept
+    {
+        return size;
+    }
+
+    /**
+     * @brief Gets the total buffer capacity
+     *
+     * @return the total capacity, in bytes
+     */
+    [[nodiscard]] constexpr size_t GetCapacityBytes() const noexcept
+    {
+        return size * sizeof(T);
+    }
+
+    /**
+     * @brief Gets the number of elements that are currently stored
+     *        in the buffer
+     *
+     * The result is only a snapshot and it includes the elements that
+     * are still being written by producers.
+     *
+     * @return current buffer length, in elements
+     */
+    [[nodiscard]] size_t GetCurrentSize() const noexcept
+    {
+        const size_t dequeuePos = m_dequeuePos.load(std::memory_order_acquire);
+        const size_t enqueuePos = m_enqueuePos.load(std::memory_order_acquire);
+        const size_t currentSize = enqueuePos - dequeuePos;
+
+        // The two indices are not read at the same time
+        return currentSize > size ? 0 : currentSize;
+    }
+
+    /**
+     * @brief Checks, if the buffer is empty
+     *
+     * @return true, if it is empty,
+     * @return false otherwise
+     */
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return GetCurrentSize() == 0;
+    }
+
+    ///@}
+
+    /**
+     * @name Operations
+     */
+    ///@{
+
+    /**
+     * @brief Pushes multiple elements into the circular buffer,
+     *        increasing its size
+     *
+     * @tparam It iterator type, must support preincrementation and dereferencing
+     * @param begin an iterator to the beginning
+     * @param end an iterator to the end
+     * @return the number of elements pushed, which can be less than
+     *         the number of elements provided if the buffer is overrun
+     */
+    template <typename It>
+    size_t PushMany(It begin, It end) noexcept
+    {
+        static_assert(std::is_same<std::decay_t<decltype(*begin)>, std::decay_t<T>>::value,
+            "The provided iterator does not dereference to type T");
+
+        size_t pushed = 0;
+
+        while (!(begin == end) && PushOne(*begin)) {
+            ++begin;
+            ++pushed;
+        }
+
+        return pushed;
+    }
+
+    /**
+     * @brief Pushes a single element into the circular buffer,
+     *        increasing its size
+     *
+     * @sa operator<<()
+     *
+     * @param value the value to be placed into the buffer
+     * @return true, if the operation succeeded (buffer wasn't full),
+     * @return false otherwise
+     */
+    bool PushOne(const T& value) noexcept
+    {
+        size_t position = m_enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+
+        while (true) {
+            cell = &m_cells[position & (size - 1)];
+            const auto lag = static_cast<std::ptrdiff_t>(
+                GetSequence(*cell, position) - position);
+
+            if (lag == 0) {
+                if (m_enqueuePos.compare_exchange_weak(
+                        position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (lag < 0) {
+                return false;
+            } else {
+                position = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        std::construct_at(&cell->value, value);
+        SetSequence(*cell, position, position + 1);
+        return true;
+    }
+
+    /**
+     * @brief Pops the next element in the circular buffer, i.e. removes it
+     *
+     * @sa PeekAndPop()
+     *
+     * @return true, if the operation succeeded (there was at least one element
+               in the buffer),
+     * @return false otherwise
+     */
+    bool Pop() noexcept
+    {
+        size_t position;
+        Cell* cell = ClaimForRead(position);
+
+        if (cell == nullptr) {
+            return false;
+        }
+
+        std::destroy_at(&cell->value);
+        SetSequence(*cell, position, position + size);
+        return true;
+    }
+
+    /**
+     * @brief Retrieves the next element in the circular buffer.
+     *
+     * If the buffer is empty, the reference provided as an argument
+     * stays untouched.
+     *
+     * @sa operator>>()
+     *
+     * @param out a reference to the value that will be populated by the
+     *            next element
+     *
+     * @return true, if the operation succeeded
+     * @return false otherwise
+     */
+    bool PeekAndPop(T& out) noexcept
+    {
+        size_t position;
+        Cell* cell = ClaimForRead(position);
+
+        if (cell == nullptr) {
+            return false;
+        }
+
+        out = std::move(cell->value);
+        std::destroy_at(&cell->value);
+        SetSequence(*cell, position, position + size);
+        return true;
+    }
+
+    ///@}
+
+private:
+    /**
+     * @brief A single slot of the buffer
+     *
+     * The sequence is stored relative to the slot index, so a zero-initialized
+     * buffer is ready to use without running any initialization loop.
+     * The value is uninitialized storage, it is constructed and destroyed
+     * in place.
+     */
+    struct Cell {
+        constexpr Cell() noexcept { }
+
+        ~Cell() noexcept { }
+
+        ~Cell() noexcept
+            requires std::is_trivially_destructible<T>::value
+        = default;
+
+        std::atomic<std::size_t> sequence { 0 };
+        union {
+            T value;
+        };
+    };
+
+    std::array<Cell, size> m_cells {};
+    std::atomic<std::size_t> m_enqueuePos { 0 };
+    std::atomic<std::size_t> m_dequeuePos { 0 };
+
+    /**
+     * @brief Claims the next cell holding a published element
+     *
+     * @param position set to the position of the claimed cell
+     * @return the claimed cell, or nullptr if the buffer is empty
+     */
+    Cell* ClaimForRead(size_t& position) noexcept
+    {
+        position = m_dequeuePos.load(std::memory_order_relaxed);
+
+        while (true) {
+            Cell* cell = &m_cells[position & (size - 1)];
+            const auto lag = static_cast<std::ptrdiff_t>(
+                GetSequence(*cell, position) - (position + 1));
+
+            if (lag < 0) {
+                return nullptr;
+            }
+
+            if constexpr (multiConsumer) {
+                if (lag == 0) {
+                    if (m_dequeuePos.compare_exchange_weak(
+                            position, position + 1, std::memory_order_relaxed)) {
+                        return cell;
+                    }
+                } else {
+                    position = m_dequeuePos.load(std::memory_order_relaxed);
+                }
+            } else {
+                m_dequeuePos.store(position + 1, std::memory_order_relaxed);
+                return cell;
+            }
+        }
+    }
+
+    /**
+     * @brief Loads the absolute sequence number of a cell at a given position
+     */
+    static size_t GetSequence(const Cell& cell, size_t position) noexcept
+    {
+        return cell.sequence.load(std::memory_order_acquire) + (position & (size - 1));
+    }
+
+    /**
+     * @brief Publishes the absolute sequence number of a cell at a given position
+     */
+    static void SetSequence(Cell& cell, size_t position, size_t sequence) noexcept
+    {
+        cell.sequence.store(sequence - (position & (size - 1)), std::memory_order_release);
+    }
+};
+
+/**
+ * @brief A type alias for a lock-free circular buffer with many producers
+ *        and many consumers
+ *
+ * @sa MultiProducerCircularBuffer
+ *
+ * @tparam T the type of elements being stored
+ * @tparam size buffer capacity, must be a power of two greater than 1
+ */
+template <typename T, std::size_t size>
+using MpmcRingBuffer = MultiProducerCircularBuffer<T, size, true>;
+
+/**
+ * @brief A type alias for a lock-free circular buffer with many producers
+ *        and a single consumer
+ *
+ * @sa MultiProducerCircularBuffer
+ *
+ * @tparam T the type of elements being stored
+ * @tparam size buffer capacity, must be a power of two greater than 1
  */
-template <typename T, std::size_t size, typename MutexImpl_t = NopMutexImpl>
-using RingBuffer = CircularBuffer<T, size, MutexImpl_t>;
+template <typename T, std::size_t size>
+using MpscRingBuffer = MultiProducerCircularBuffer<T, size, false>;
 
 };
@@ -0,0 +1,294 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "staticstring.hpp"
+
+namespace lg {
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+
+/**
+ * @brief A string literal usable as a template argument, holding
+ *        a format string for Format()
+ *
+ * @tparam length literal length (with terminator character)
+ */
+template <size_t length>
+struct FormatString {
+    /**
+     * @brief Captures a string literal at compile time
+     *
+     * @param literal reference to the literal
+     */
+    consteval FormatString(const char (&literal)[length]) noexcept
+    {
+        std::copy_n(literal, length, chars);
+    }
+
+    /**
+     * @brief The characters of the literal
+     */
+    char chars[length] {};
+};
+
+// NOLINTEND(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+
+/**
+ * @brief Problems detected while parsing a format string
+ */
+enum class FormatError {
+    /**
+     * @brief No problem, the format string is valid
+     */
+    None,
+
+    /**
+     * @brief A '{' without a matching '}', or a '}' not preceded by '{'
+     *        and not doubled
+     */
+    UnmatchedBrace,
+
+    /**
+     * @brief A placeholder other than "{}" or "{x}"
+     */
+    UnknownSpecifier,
+};
+
+/**
+ * @brief A format string split at compile time into literal text and
+ *        placeholders
+ *
+ * @tparam length format string length (with terminator character)
+ * @tparam argumentCount number of arguments passed to Format()
+ */
+template <size_t length, size_t argumentCount>
+struct ParsedFormat {
+    /**
+     * @brief The literal text, with the placeholders removed and
+     *        the escaped braces collapsed
+     */
+    std::array<char, length> text {};
+
+    /**
+     * @brief Length of the literal text
+     */
+    size_t textLength { 0 };
+
+    /**
+     * @brief End of every text segment, the n-th segment
+     *        precedes the n-th placeholder
+     */
+    std::array<size_t, argumentCount + 1> segmentEnds {};
+
+    /**
+     * @brief Specifier of every placeholder, '\0' for "{}" and 'x' for "{x}"
+     */
+    std::array<char, argumentCount> specifiers {};
+
+    /**
+     * @brief Number of placeholders found
+     */
+    size_t placeholders { 0 };
+
+    /**
+     * @brief The first problem found
+     */
+    FormatError error { FormatError::None };
+};
+
+/**
+ * @brief Splits a format string into literal text and placeholders
+ *
+ * "{}" formats an argument in its default way and "{x}" formats
+ * an integer in hexadecimal. "{{" and "}}" stand for literal braces.
+ *
+ * @tparam format the format string
+ * @tparam argumentCount number of arguments passed to Format()
+ * @return the parsed format
+ */
+template <FormatString format, size_t argumentCount>
+consteval auto ParseFormat() noexcept
+{
+    constexpr size_t LENGTH = sizeof(format.chars);
+    ParsedFormat<LENGTH, argumentCount> result;
+
+    for (size_t i = 0; i + 1 < LENGTH; ++i) {
+        const char c = format.chars[i];
+        const char next = format.chars[i + 1];
+
+        if ((c == '{' && next == '{') || (c == '}' && next == '}')) {
+            result.text[result.textLength++] = c;
+            ++i;
+        } else if (c == '{') {
+            size_t end = i + 1;
+            while (end + 1 < LENGTH && format.chars[end] != '}' && format.chars[end] != '{') {
+                ++end;
+            }
+
+            if (format.chars[end] != '}') {
+                result.error = FormatError::UnmatchedBrace;
+                return result;
+            }
+
+            char specifier = '\0';
+            if (end == i + 2 && format.chars[i + 1] == 'x') {
+                specifier = 'x';
+            } else if (end != i + 1) {
+                result.error = FormatError::UnknownSpecifier;
+                return result;
+            }
+
+            if (result.placeholders < argumentCount) {
+                result.segmentEnds[result.placeholders] = result.textLength;
+                result.specifiers[result.placeholders] = specifier;
+            }
+
+            ++result.placeholders;
+            i = end;
+        } else if (c == '}') {
+            result.error = FormatError::UnmatchedBrace;
+            return result;
+        } else {
+            result.text[result.textLength++] = c;
+        }
+    }
+
+    if (result.placeholders <= argumentCount) {
+        result.segmentEnds[result.placeholders] = result.textLength;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Gets the capacity of a StaticString type, 0 for other types
+ */
+template <typename T>
+inline constexpr size_t STATIC_STRING_CAPACITY = 0;
+
+template <size_t maxSize>
+inline constexpr size_t STATIC_STRING_CAPACITY<StaticString<maxSize>> = maxSize;
+
+/**
+ * @brief Gets the maximum number of characters Format() writes
+ *        for an argument
+ *
+ * @tparam T type of the argument
+ * @tparam specifier specifier of the placeholder
+ * @return maximum number of characters
+ */
+template <typename T, char specifier>
+consteval size_t MaxFormattedLength() noexcept
+{
+    using Limits = std::numeric_limits<T>;
+    constexpr size_t FLOAT_EXTRA_CHARACTERS = 8; // sign, point and exponent
+
+    if constexpr (specifier == 'x') {
+        static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value,
+            "{x} requires an integer argument");
+        return sizeof(T) * 2;
+    } else if constexpr (std::is_same<T, bool>::value) {
+        return sizeof("false") - 1;
+    } else if constexpr (std::is_same<T, char>::value) {
+        return 1;
+    } else if constexpr (std::is_integral<T>::value) {
+        return Limits::digits10 + 1 + (Limits::is_signed ? 1 : 0);
+    } else if constexpr (std::is_floating_point<T>::value) {
+        return Limits::max_digits10 + FLOAT_EXTRA_CHARACTERS;
+    } else if constexpr (STATIC_STRING_CAPACITY<T> > 0) {
+        return STATIC_STRING_CAPACITY<T>;
+    } else if constexpr (std::is_array<T>::value
+        && std::is_same<std::remove_extent_t<T>, char>::value) {
+        return std::extent<T>::value - 1;
+    } else {
+        static_assert(!sizeof(T), "argument type has no bounded formatted length");
+        return 0;
+    }
+}
+
+/**
+ * @brief Writes an argument of Format()
+ *
+ * @tparam specifier specifier of the placeholder
+ * @tparam T type of the argument
+ * @tparam maxSize capacity of the result
+ * @param result the string being formatted
+ * @param value the argument
+ */
+template <char specifier, typename T, size_t maxSize>
+void AppendFormatted(StaticString<maxSize>& result, const T& value) noexcept
+{
+    if constexpr (specifier == 'x') {
+        result.AppendHex(value);
+    } else if constexpr (std::is_same<T, bool>::value) {
+        result += value ? "true" : "false";
+    } else if constexpr (std::is_same<T, char>::value) {
+        result += value;
+    } else if constexpr (std::is_integral<T>::value) {
+        result.AppendNumber(value);
+    } else if constexpr (std::is_floating_point<T>::value) {
+        result.AppendFloat(value);
+    } else if constexpr (STATIC_STRING_CAPACITY<T> > 0) {
+        result += value;
+    } else {
+        result.Append(value, std::find(std::begin(value), std::end(value) - 1, '\0') - value);
+    }
+}
+
+/**
+ * @brief Formats the arguments into a StaticString, according to a format
+ *        string parsed and validated at compile time
+ *
+ * "{}" writes an argument in its default way: integers in decimal,
+ * floating-point values in their shortest round-trip form, bool as
+ * true/false, strings and characters as they are. "{x}" writes
+ * an integer in hexadecimal. "{{" and "}}" stand for literal braces.
+ *
+ * The capacity of the result is deduced from the format string and
+ * the longest possible representation of every argument type, so nothing
+ * is ever truncated. Only types of bounded length are accepted: integers,
+ * floating-point values, characters, StaticString and char arrays.
+ *
+ * @tparam format the format string
+ * @tparam Args types of the arguments
+ * @param args the arguments, one per placeholder
+ * @return the formatted string
+ */
+template <FormatString format, typename... Args>
+auto Format(const Args&... args) noexcept
+{
+    static constexpr auto PARSED = ParseFormat<format, sizeof...(Args)>();
+
+    static_assert(PARSED.error != FormatError::UnmatchedBrace,
+        "unmatched brace in format string, use {{ and }} for literal braces");
+    static_assert(PARSED.error != FormatError::UnknownSpecifier,
+        "unknown placeholder in format string, only {} and {x} are supported");
+    static_assert(PARSED.placeholders == sizeof...(Args),
+        "number of arguments does not match the number of placeholders");
+
+    static constexpr size_t CAPACITY = []<size_t... I>(std::index_sequence<I...>) {
+        return PARSED.textLength + (MaxFormattedLength<Args, PARSED.specifiers[I]>() + ... + 0);
+    }(std::index_sequence_for<Args...> {});
+
+    StaticString<std::max<size_t>(1, CAPACITY)> result;
+    const auto appendSegment = [&result](size_t segment) {
+        const size_t start = segment == 0 ? 0 : PARSED.segmentEnds[segment - 1];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        result.Append(PARSED.text.data() + start, PARSED.segmentEnds[segment] - start);
+    };
+
+    appendSegment(0);
+    [&]<size_t... I>(std::index_sequence<I...>) {
+        ((AppendFormatted<PARSED.specifiers[I]>(result, args), appendSegment(I + 1)), ...);
+    }(std::index_sequence_for<Args...> {});
+
+    return result;
+}
+
+};
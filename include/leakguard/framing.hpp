@@ -0,0 +1,382 @@
+#pragma once
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "circularbuffer.hpp"
+#include "staticstring.hpp"
+#include "staticstringview.hpp"
+#include "stringsearch.hpp"
+
+namespace lg {
+
+/**
+ * @brief Checks, if a type is a CircularBuffer of chars
+ */
+template <typename T>
+inline constexpr bool IS_CHAR_CIRCULAR_BUFFER = false;
+
+template <std::size_t size, typename MutexImpl_t, OverflowPolicy overflowPolicy,
+    typename StatsImpl_t, std::size_t cacheLineSize>
+inline constexpr bool IS_CHAR_CIRCULAR_BUFFER<
+    CircularBuffer<char, size, MutexImpl_t, overflowPolicy, StatsImpl_t, cacheLineSize>>
+    = true;
+
+/**
+ * @brief The outcome of looking for a frame in a CircularBuffer
+ */
+enum class FrameStatus {
+    /**
+     * @brief A whole frame was found
+     */
+    Complete,
+
+    /**
+     * @brief The frame has not fully arrived yet, nothing was removed
+     *        from the buffer
+     */
+    Incomplete,
+
+    /**
+     * @brief The frame does not fit in the output string, or will never fit
+     *        in the buffer, and was dropped
+     */
+    TooLong,
+
+    /**
+     * @brief The frame is not validly encoded and was dropped
+     */
+    Malformed,
+};
+
+/**
+ * @brief A frame found in a CircularBuffer, viewed in place
+ *
+ * The frame may wrap around the end of the buffer storage, in which case
+ * it is split into two views. Both stay valid until the frame is released
+ * with ReleaseRead(consumed).
+ */
+struct FrameRegions {
+    /**
+     * @brief The frame contents, or their first part
+     */
+    StaticStringView first;
+
+    /**
+     * @brief The rest of the frame contents, empty unless the frame wraps
+     */
+    StaticStringView second;
+
+    /**
+     * @brief The number of characters to release once the frame has been
+     *        handled, including the delimiter or the length prefix
+     */
+    size_t consumed { 0 };
+
+    /**
+     * @brief Whether a whole frame was found, the views are empty otherwise
+     */
+    FrameStatus status { FrameStatus::Incomplete };
+
+    /**
+     * @brief Gets the total number of characters in both views
+     *
+     * @return the number of characters
+     */
+    [[nodiscard]] size_t GetSize() const noexcept
+    {
+        return first.GetSize() + second.GetSize();
+    }
+
+    /**
+     * @brief Gets a character of the frame
+     *
+     * @param n index of the character, less than GetSize()
+     * @return the character
+     */
+    [[nodiscard]] char At(size_t n) const noexcept
+    {
+        return n < first.GetSize() ? first[n] : second[n - first.GetSize()];
+    }
+
+    /**
+     * @brief Appends a part of the frame to a string, in at most two copies
+     *
+     * @tparam maxSize capacity of the string
+     * @param out the string to append to
+     * @param position index of the first character to append
+     * @param count number of characters to append
+     */
+    template <size_t maxSize>
+    void AppendTo(StaticString<maxSize>& out, size_t position, size_t count) const noexcept
+    {
+        const StaticStringView head = first.Substr(position, count);
+        const StaticStringView tail = second.Substr(
+            position - std::min(position, first.GetSize()), count - head.GetSize());
+
+        out.Append(head.GetDataPtr(), head.GetSize());
+        out.Append(tail.GetDataPtr(), tail.GetSize());
+    }
+};
+
+/**
+ * @name Frame extraction
+ *
+ * Cut frames of a serial protocol directly out of a CircularBuffer<char>,
+ * without popping it character by character. The Find functions only view
+ * the frame in place, the Extract functions copy it into a StaticString in
+ * one go and remove it from the buffer with a single PopMany().
+ *
+ * These functions must be called from the consumer side. With
+ * OverflowPolicy::OverwriteOldest, the producer must not push while a frame
+ * is being looked at.
+ *
+ * If the buffer fills up before a frame is complete, the frame can never
+ * be completed, so the whole buffer is dropped and FrameStatus::TooLong
+ * is reported. Whatever is left of that frame arrives as the beginning of
+ * the next one, which delimited and COBS framing recover from.
+ */
+///@{
+
+/**
+ * @brief Finds a frame ending with a delimiter, e.g. a line
+ *
+ * The delimiter is searched for with FindChar(), in each of the two
+ * contiguous blocks of stored characters.
+ *
+ * @tparam Buffer circular buffer type
+ * @param buffer the buffer to look into
+ * @param delimiter the character ending the frame
+ * @return the frame without the delimiter, and the number of characters
+ *         it takes up with the delimiter
+ */
+template <typename Buffer>
+    requires IS_CHAR_CIRCULAR_BUFFER<Buffer>
+FrameRegions FindDelimitedFrame(const Buffer& buffer, char delimiter = '\n') noexcept
+{
+    const auto regions = buffer.AcquireReadRegions();
+    const StaticStringView first(regions.first.data(), regions.first.size());
+    const StaticStringView second(regions.second.data(), regions.second.size());
+
+    size_t position = FindChar(first.GetDataPtr(), first.GetSize(), delimiter);
+    if (position == first.GetSize()) {
+        position += FindChar(second.GetDataPtr(), second.GetSize(), delimiter);
+    }
+
+    if (position == regions.GetSize()) {
+        return {};
+    }
+
+    return { first.Substr(0, position),
+        second.Substr(0, position - std::min(position, first.GetSize())),
+        position + 1, FrameStatus::Complete };
+}
+
+/**
+ * @brief Finds a frame preceded by its length
+ *
+ * The length is stored in sizeof(LengthType) characters, most significant
+ * first (network byte order).
+ *
+ * @tparam LengthType unsigned type of the length prefix
+ * @tparam Buffer circular buffer type
+ * @param buffer the buffer to look into
+ * @return the frame without the prefix, and the number of characters
+ *         it takes up with the prefix
+ */
+template <typename LengthType = std::uint8_t, typename Buffer>
+    requires IS_CHAR_CIRCULAR_BUFFER<Buffer>
+FrameRegions FindLengthPrefixedFrame(const Buffer& buffer) noexcept
+{
+    static_assert(std::is_unsigned<LengthType>::value, "length prefix must be unsigned");
+
+    const auto regions = buffer.AcquireReadRegions();
+    const FrameRegions stored {
+        { regions.first.data(), regions.first.size() },
+        { regions.second.data(), regions.second.size() },
+    };
+
+    constexpr size_t PREFIX = sizeof(LengthType);
+    if (stored.GetSize() < PREFIX) {
+        return {};
+    }
+
+    size_t length = 0;
+    for (size_t i = 0; i < PREFIX; ++i) {
+        length = (length << CHAR_BIT) | static_cast<unsigned char>(stored.At(i));
+    }
+
+    if (stored.GetSize() - PREFIX < length) {
+        return {};
+    }
+
+    const StaticStringView first = stored.first.Substr(PREFIX, length);
+    const StaticStringView second = stored.second.Substr(
+        PREFIX - std::min(PREFIX, stored.first.GetSize()), length - first.GetSize());
+
+    return { first, second, PREFIX + length, FrameStatus::Complete };
+}
+
+/**
+ * @brief Copies a found frame into a string and removes it from the buffer,
+ *        or drops a full buffer that holds no complete frame
+ *
+ * @tparam Buffer circular buffer type
+ * @tparam maxSize capacity of the output string
+ * @param buffer the buffer the frame was found in
+ * @param out the string receiving the frame
+ * @param frame the frame found
+ * @return status of the frame
+ */
+template <typename Buffer, size_t maxSize>
+    requires IS_CHAR_CIRCULAR_BUFFER<Buffer>
+FrameStatus ExtractFrame(Buffer& buffer, StaticString<maxSize>& out, const FrameRegions& frame) noexcept
+{
+    out.Clear();
+
+    if (frame.status != FrameStatus::Complete) {
+        if (buffer.GetCurrentSize() < buffer.GetCapacity()) {
+            return frame.status;
+        }
+
+        buffer.Clear();
+        return FrameStatus::TooLong;
+    }
+
+    const bool fits = frame.GetSize() <= maxSize;
+    if (fits) {
+        frame.AppendTo(out, 0, frame.GetSize());
+    }
+
+    buffer.PopMany(frame.consumed);
+    return fits ? FrameStatus::Complete : FrameStatus::TooLong;
+}
+
+/**
+ * @brief Extracts a frame ending with a delimiter, e.g. a line
+ *
+ * @sa FindDelimitedFrame()
+ *
+ * @tparam Buffer circular buffer type
+ * @tparam maxSize capacity of the output string
+ * @param buffer the buffer to extract from
+ * @param out the string receiving the frame without the delimiter,
+ *            cleared unless the frame is complete
+ * @param delimiter the character ending the frame
+ * @return FrameStatus::Complete if a frame was extracted
+ */
+template <typename Buffer, size_t maxSize>
+    requires IS_CHAR_CIRCULAR_BUFFER<Buffer>
+FrameStatus ExtractDelimitedFrame(
+    Buffer& buffer, StaticString<maxSize>& out, char delimiter = '\n') noexcept
+{
+    return ExtractFrame(buffer, out, FindDelimitedFrame(buffer, delimiter));
+}
+
+/**
+ * @brief Extracts a line ending with '\n', dropping a '\r' before it
+ *
+ * @tparam Buffer circular buffer type
+ * @tparam maxSize capacity of the output string
+ * @param buffer the buffer to extract from
+ * @param out the string receiving the line, cleared unless a line
+ *            was extracted
+ * @return FrameStatus::Complete if a line was extracted
+ */
+template <typename Buffer, size_t maxSize>
+    requires IS_CHAR_CIRCULAR_BUFFER<Buffer>
+FrameStatus ExtractLine(Buffer& buffer, StaticString<maxSize>& out) noexcept
+{
+    FrameRegions frame = FindDelimitedFrame(buffer, '\n');
+
+    if (frame.status == FrameStatus::Complete && frame.GetSize() > 0
+        && frame.At(frame.GetSize() - 1) == '\r') {
+        StaticStringView& last = frame.second.IsEmpty() ? frame.first : frame.second;
+        last.Truncate(last.GetSize() - 1);
+    }
+
+    return ExtractFrame(buffer, out, frame);
+}
+
+/**
+ * @brief Extracts a frame preceded by its length
+ *
+ * @sa FindLengthPrefixedFrame()
+ *
+ * @tparam LengthType unsigned type of the length prefix
+ * @tparam Buffer circular buffer type
+ * @tparam maxSize capacity of the output string
+ * @param buffer the buffer to extract from
+ * @param out the string receiving the frame without the prefix,
+ *            cleared unless the frame is complete
+ * @return FrameStatus::Complete if a frame was extracted
+ */
+template <typename LengthType = std::uint8_t, typename Buffer, size_t maxSize>
+    requires IS_CHAR_CIRCULAR_BUFFER<Buffer>
+FrameStatus ExtractLengthPrefixedFrame(Buffer& buffer, StaticString<maxSize>& out) noexcept
+{
+    return ExtractFrame(buffer, out, FindLengthPrefixedFrame<LengthType>(buffer));
+}
+
+/**
+ * @brief Extracts and decodes a COBS (Consistent Overhead Byte Stuffing)
+ *        frame, which ends with a zero character
+ *
+ * The decoded frame may contain zero characters, so it should be viewed
+ * with StaticStringView or iterated over, rather than used as a zero-terminated
+ * array. A lone zero decodes to nothing and is reported as
+ * FrameStatus::Malformed.
+ *
+ * @tparam Buffer circular buffer type
+ * @tparam maxSize capacity of the output string
+ * @param buffer the buffer to extract from
+ * @param out the string receiving the decoded frame, cleared unless
+ *            the frame is complete
+ * @return FrameStatus::Complete if a frame was extracted
+ */
+template <typename Buffer, size_t maxSize>
+    requires IS_CHAR_CIRCULAR_BUFFER<Buffer>
+FrameStatus ExtractCobsFrame(Buffer& buffer, StaticString<maxSize>& out) noexcept
+{
+    constexpr unsigned MAX_CODE = 0xFF;
+
+    const FrameRegions frame = FindDelimitedFrame(buffer, '\0');
+    if (frame.status != FrameStatus::Complete) {
+        return ExtractFrame(buffer, out, frame);
+    }
+
+    out.Clear();
+
+    FrameStatus status = frame.GetSize() > 0 ? FrameStatus::Complete : FrameStatus::Malformed;
+
+    for (size_t position = 0; position < frame.GetSize() && status == FrameStatus::Complete;) {
+        const unsigned code = static_cast<unsigned char>(frame.At(position));
+        const bool zeroFollows = code != MAX_CODE && position + code < frame.GetSize();
+
+        if (position + code > frame.GetSize()) {
+            status = FrameStatus::Malformed;
+        } else if (out.GetSize() + code - (zeroFollows ? 0 : 1) > maxSize) {
+            status = FrameStatus::TooLong;
+        } else {
+            frame.AppendTo(out, position + 1, code - 1);
+            if (zeroFollows) {
+                out += '\0';
+            }
+        }
+
+        position += code;
+    }
+
+    if (status != FrameStatus::Complete) {
+        out.Clear();
+    }
+
+    buffer.PopMany(frame.consumed);
+    return status;
+}
+
+///@}
+
+};
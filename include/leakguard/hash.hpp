@@ -0,0 +1,221 @@
+#pragma once
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "staticstring.hpp"
+#include "staticstringview.hpp"
+#include "stringsearch.hpp"
+
+namespace lg {
+
+/**
+ * @brief Loads up to 8 characters into a word, the first one in the lowest
+ *        byte on every platform and in constant evaluation
+ *
+ * @param data pointer to the characters
+ * @param count number of characters to load, at most 8
+ * @return the loaded word, with unused bytes set to 0
+ */
+inline constexpr std::uint64_t LoadLittleEndianWord(const char* data, std::size_t count) noexcept
+{
+    if (!std::is_constant_evaluated()) {
+        if constexpr (std::endian::native == std::endian::little) {
+            return SwarLoad(data, count);
+        }
+    }
+
+    std::uint64_t word = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        word |= std::uint64_t { static_cast<unsigned char>(data[i]) } << (i * 8);
+    }
+
+    return word;
+}
+
+/**
+ * @brief Hashes a sequence of characters
+ *
+ * The characters are consumed 8 at a time, with a multiply-xorshift step
+ * per word, so hashing e.g. a 32-character string takes 4 multiplications.
+ * The result is the same at compile time and at runtime, so hashes of
+ * literals can be used as case labels:
+ *
+ * @code
+ * switch (lg::Hash(command)) {
+ * case lg::Hash(lg::STR("reset")):
+ *     ...
+ * }
+ * @endcode
+ *
+ * The results may differ between platforms with different size_t widths.
+ *
+ * @param string the characters to hash
+ * @return the hash
+ */
+inline constexpr size_t Hash(StaticStringView string) noexcept
+{
+    constexpr std::uint64_t MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+    constexpr unsigned SHIFT = 32;
+
+    const char* data = string.GetDataPtr();
+    size_t length = string.GetSize();
+    std::uint64_t hash = length * MULTIPLIER;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    while (length > 0) {
+        const size_t chunk = length < sizeof(std::uint64_t) ? length : sizeof(std::uint64_t);
+
+        hash = (hash ^ LoadLittleEndianWord(data, chunk)) * MULTIPLIER;
+        hash ^= hash >> SHIFT;
+
+        data += chunk;
+        length -= chunk;
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    return static_cast<size_t>(hash);
+}
+
+/**
+ * @brief An immutable StaticString that caches its hash
+ *
+ * The hash is computed once on construction, with Hash(). Comparisons look
+ * at the hashes first and compare the characters only if they match, so
+ * unequal strings are told apart in constant time. StaticHashMap uses
+ * the cached hash directly.
+ *
+ * @tparam maxSize String capacity, in characters
+ */
+template <std::size_t maxSize>
+class HashedStaticString {
+public:
+    /**
+     * @name Constructors
+     */
+    ///@{
+
+    /**
+     * @brief Default constructor, creates an empty string
+     */
+    constexpr HashedStaticString() noexcept
+        : m_hash(Hash(m_string))
+    {
+    }
+
+    /**
+     * @brief Constructs a string from the contents of another StaticString
+     *
+     * @tparam otherSize capacity of the other string
+     * @param string string to copy contents from
+     */
+    template <std::size_t otherSize>
+    constexpr HashedStaticString(const StaticString<otherSize>& string) noexcept
+        : m_string(string)
+        , m_hash(Hash(m_string))
+    {
+    }
+
+    /**
+     * @brief Constructs a string from viewed characters
+     *
+     * @param view characters to copy
+     */
+    constexpr HashedStaticString(StaticStringView view) noexcept
+        : m_string(view.GetDataPtr(), view.GetSize())
+        , m_hash(Hash(m_string))
+    {
+    }
+
+    /**
+     * @brief Constructs a string from zero-terminated C-style char array
+     *
+     * @param buffer pointer to a zero-terminated char array
+     */
+    constexpr HashedStaticString(const char* buffer) noexcept
+        : HashedStaticString(StaticStringView(buffer))
+    {
+    }
+
+    ///@}
+
+    /**
+     * @name Operators
+     */
+    ///@{
+
+    /**
+     * @brief Compares two strings for equality, hashes first
+     *
+     * @tparam otherSize capacity of the second string
+     * @param other the second string to compare
+     * @return true, if string contents match,
+     * @return false otherwise
+     */
+    template <std::size_t otherSize>
+    bool operator==(const HashedStaticString<otherSize>& other) const noexcept
+    {
+        return m_hash == other.GetHash() && m_string == other.GetString();
+    }
+
+    /**
+     * @brief Compares two strings for inequality, hashes first
+     *
+     * @tparam otherSize capacity of the second string
+     * @param other the second string to compare
+     * @return true, if string contents don't match,
+     * @return false otherwise
+     */
+    template <std::size_t otherSize>
+    bool operator!=(const HashedStaticString<otherSize>& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+    ///@}
+
+    /**
+     * @name Getters
+     */
+    ///@{
+
+    /**
+     * @brief Gets the cached hash
+     *
+     * @return the hash, equal to Hash() of the string
+     */
+    [[nodiscard]] constexpr size_t GetHash() const noexcept
+    {
+        return m_hash;
+    }
+
+    /**
+     * @brief Gets the string
+     *
+     * @return const reference to the string
+     */
+    [[nodiscard]] constexpr const StaticString<maxSize>& GetString() const noexcept
+    {
+        return m_string;
+    }
+
+    /**
+     * @brief Gets a view of the string
+     *
+     * @return view of the characters
+     */
+    [[nodiscard]] constexpr StaticStringView GetView() const noexcept
+    {
+        return m_string;
+    }
+
+    ///@}
+
+private:
+    StaticString<maxSize> m_string;
+    size_t m_hash;
+};
+
+};
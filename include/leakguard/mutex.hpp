@@ -0,0 +1,30 @@
+#pragma once
+
+namespace lg {
+
+/**
+ * @brief A default implementation of mutex that does nothing
+ *
+ * It contains an implicitly defined default constructor, as well as two
+ * inline member functions that contain no instructions. It provides none
+ * of the optional functions for waiting on and signaling data or space.
+ *
+ * This struct satisfies MutexImpl concept.
+ */
+struct NopMutexImpl {
+    /**
+     * @brief Locks the critical section
+     *
+     * This implementation is a no-op and does nothing.
+     */
+    void Lock() { }
+
+    /**
+     * @brief Unlocks the critical section
+     *
+     * This implementation is a no-op and does nothing.
+     */
+    void Unlock() { }
+};
+
+};
@@ -0,0 +1,236 @@
+#pragma once
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+namespace lg {
+
+/**
+ * @brief The outcome of parsing a number
+ *
+ * @tparam T type of the parsed number
+ */
+template <typename T>
+struct ParseResult {
+    /**
+     * @brief The parsed number, or 0 if parsing failed
+     */
+    T value {};
+
+    /**
+     * @brief std::errc::invalid_argument if the characters are not
+     *        a number, std::errc::result_out_of_range if the number
+     *        does not fit in T, value-initialized otherwise
+     */
+    std::errc error {};
+
+    /**
+     * @brief Checks, if parsing succeeded
+     *
+     * @return true if it did,
+     * @return false otherwise
+     */
+    [[nodiscard]] explicit operator bool() const noexcept
+    {
+        return error == std::errc {};
+    }
+};
+
+/**
+ * @name Number parsing kernels
+ *
+ * Building blocks of StaticString and StaticStringView parsing, operating
+ * on plain character ranges. Unlike std::from_chars(), the whole range has
+ * to be a number, trailing characters are an error.
+ */
+///@{
+
+/**
+ * @brief Converts 8 decimal digits at once, if they all are digits
+ *
+ * The digits are combined pairwise, then in fours and then in eights,
+ * using three multiplications instead of seven.
+ *
+ * @param data pointer to 8 characters
+ * @param[out] value the number made of the digits
+ * @return true, if all 8 characters are decimal digits,
+ * @return false otherwise
+ */
+inline bool ParseEightDigits(const char* data, std::uint32_t& value) noexcept
+{
+    static constexpr std::uint64_t ZEROS = 0x3030303030303030ULL;
+    static constexpr std::uint64_t HIGH_NIBBLES = 0xF0F0F0F0F0F0F0F0ULL;
+    static constexpr std::uint64_t SIXES = 0x0606060606060606ULL;
+    static constexpr std::uint64_t BYTE_PAIRS = 0x00FF00FF00FF00FFULL;
+    static constexpr std::uint64_t WORD_PAIRS = 0x0000FFFF0000FFFFULL;
+    static constexpr std::uint64_t TENS = 1 + (std::uint64_t { 10 } << 8);
+    static constexpr std::uint64_t HUNDREDS = 1 + (std::uint64_t { 100 } << 16);
+    static constexpr std::uint64_t TEN_THOUSANDS = 1 + (std::uint64_t { 10000 } << 32);
+    static constexpr unsigned SHIFT_8 = 8;
+    static constexpr unsigned SHIFT_16 = 16;
+    static constexpr unsigned SHIFT_32 = 32;
+
+    std::uint64_t word = 0;
+    std::memcpy(&word, data, sizeof(word));
+
+    // Every byte must be 0x3?, and stay so after adding 6 (rejects ':' to '?')
+    if ((word & HIGH_NIBBLES) != ZEROS || ((word + SIXES) & HIGH_NIBBLES) != ZEROS) {
+        return false;
+    }
+
+    // The first, most significant digit sits in the lowest byte
+    word -= ZEROS;
+    word = ((word * TENS) >> SHIFT_8) & BYTE_PAIRS;
+    word = ((word * HUNDREDS) >> SHIFT_16) & WORD_PAIRS;
+    value = static_cast<std::uint32_t>((word * TEN_THOUSANDS) >> SHIFT_32);
+    return true;
+}
+
+/**
+ * @brief Gets the value of a digit in bases up to 36
+ *
+ * @param c the digit character, 0-9 or a letter in either case
+ * @return the value of the digit, or 36 or more for other characters
+ */
+inline constexpr unsigned DigitValue(char c) noexcept
+{
+    constexpr unsigned LETTERS_START = 10;
+    constexpr unsigned char LOWERCASE_BIT = 0x20;
+
+    const auto uc = static_cast<unsigned char>(c);
+
+    if (uc >= '0' && uc <= '9') {
+        return uc - '0';
+    }
+
+    const auto lower = static_cast<unsigned char>(uc | LOWERCASE_BIT);
+    if (lower >= 'a' && lower <= 'z') {
+        return lower - 'a' + LETTERS_START;
+    }
+
+    return std::numeric_limits<unsigned>::max();
+}
+
+/**
+ * @brief Parses a whole character range as an integer
+ *
+ * A leading '-' is accepted for signed types. Decimal numbers are
+ * converted 8 digits at a time, on little-endian platforms.
+ *
+ * @tparam T integer type
+ * @param data pointer to the characters
+ * @param length number of characters
+ * @param base numeric base, from 2 to 36
+ * @return the parsed number and the error code
+ */
+template <std::integral T>
+ParseResult<T> ParseInteger(const char* data, std::size_t length, unsigned base = 10) noexcept
+{
+    static constexpr unsigned DECIMAL = 10;
+    static constexpr unsigned MAX_BASE = 36;
+    static constexpr std::uint32_t EIGHT_DIGITS = 100000000;
+    static constexpr std::size_t CHUNK = 8;
+
+    using UT = std::common_type_t<std::make_unsigned_t<T>, unsigned>;
+
+    if (base < 2 || base > MAX_BASE) {
+        return { T {}, std::errc::invalid_argument };
+    }
+
+    bool negative = false;
+    std::size_t position = 0;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if constexpr (std::is_signed<T>::value) {
+        if (length > 0 && data[0] == '-') {
+            negative = true;
+            position = 1;
+        }
+    }
+
+    if (position == length) {
+        return { T {}, std::errc::invalid_argument };
+    }
+
+    // The magnitude of the most negative value is one past the maximum
+    const UT limit = static_cast<UT>(std::numeric_limits<T>::max()) + (negative ? 1U : 0U);
+    UT value = 0;
+    bool overflow = false;
+
+    if constexpr (std::endian::native == std::endian::little
+        && std::numeric_limits<UT>::max() >= EIGHT_DIGITS) {
+        if (base == DECIMAL) {
+            std::uint32_t chunk = 0;
+
+            while (length - position >= CHUNK && ParseEightDigits(data + position, chunk)) {
+                if (chunk > limit || value > (limit - chunk) / EIGHT_DIGITS) {
+                    overflow = true;
+                } else {
+                    value = value * EIGHT_DIGITS + chunk;
+                }
+
+                position += CHUNK;
+            }
+        }
+    }
+
+    for (; position < length; ++position) {
+        const unsigned digit = DigitValue(data[position]);
+
+        if (digit >= base) {
+            return { T {}, std::errc::invalid_argument };
+        }
+
+        if (value > (limit - digit) / base) {
+            overflow = true;
+        } else if (!overflow) {
+            value = value * base + digit;
+        }
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    if (overflow) {
+        return { T {}, std::errc::result_out_of_range };
+    }
+
+    return { static_cast<T>(negative ? UT {} - value : value), std::errc {} };
+}
+
+/**
+ * @brief Parses a whole character range as a floating-point number
+ *
+ * @tparam T floating-point type
+ * @param data pointer to the characters
+ * @param length number of characters
+ * @param format accepted notations, as in std::from_chars()
+ * @return the parsed number and the error code
+ */
+template <std::floating_point T>
+ParseResult<T> ParseFloat(const char* data, std::size_t length,
+    std::chars_format format = std::chars_format::general) noexcept
+{
+    T value {};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const auto [end, error] = std::from_chars(data, data + length, value, format);
+
+    if (error != std::errc {}) {
+        return { T {}, error };
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    if (end != data + length) {
+        return { T {}, std::errc::invalid_argument };
+    }
+
+    return { value, std::errc {} };
+}
+
+///@}
+
+};
@@ -0,0 +1,27 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace lg {
+
+/**
+ * @brief The smallest unsigned integer type able to hold values
+ *        up to (and including) `maxValue`
+ *
+ * Containers use it to store their sizes and indices, so that e.g. a short
+ * string does not spend a whole size_t on a length that never exceeds 15.
+ *
+ * @tparam maxValue the largest value to be stored
+ */
+template <std::size_t maxValue>
+using MinimalSizeType = std::conditional_t<
+    maxValue <= std::numeric_limits<std::uint8_t>::max(), std::uint8_t,
+    std::conditional_t<
+        maxValue <= std::numeric_limits<std::uint16_t>::max(), std::uint16_t,
+        std::conditional_t<
+            maxValue <= std::numeric_limits<std::uint32_t>::max(), std::uint32_t,
+            std::size_t>>>;
+
+};
@@ -0,0 +1,652 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "sizetype.hpp"
+#include "staticvector.hpp"
+
+namespace lg {
+
+/**
+ * @brief Finds the first element of a sorted array that is not less than
+ *        the key, without data-dependent branches
+ *
+ * The search halves the range on every step, selecting the half with
+ * a conditional move instead of a jump, so the loop always runs
+ * ceil(log2(count)) times and never mispredicts.
+ *
+ * @tparam K the type of elements and the key
+ * @tparam Compare the comparator the array is sorted by
+ * @param elements pointer to the sorted array
+ * @param count number of elements in the array
+ * @param key the key to search for
+ * @param compare the comparator instance
+ * @return index of the first element not less than the key, or count
+ *         if there is none
+ */
+template <typename K, typename Compare>
+constexpr size_t BranchlessLowerBound(const K* elements, size_t count,
+    const K& key, const Compare& compare) noexcept
+{
+    if (count == 0) {
+        return 0;
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const K* base = elements;
+
+    while (count > 1) {
+        const size_t half = count / 2;
+        base = compare(base[half], key) ? base + half : base;
+        count -= half;
+    }
+
+    return static_cast<size_t>(base - elements) + (compare(*base, key) ? 1 : 0);
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+/**
+ * @brief A sorted associative container mapping unique keys to values,
+ *        using only statically allocated memory.
+ *
+ * Keys and values are kept in two separate StaticVector instances, both
+ * ordered by key, so that lookups only touch the keys. Lookups use
+ * BranchlessLowerBound() and take O(log n), insertions and removals shift
+ * the following entries and take O(n). To fill the map with many entries
+ * at once, BuildFrom() sorts them just once.
+ *
+ * StaticFlatMap will never throw any exceptions.
+ *
+ * @tparam K the type of keys, must be ordered by Compare
+ * @tparam V the type of values
+ * @tparam maxSize map capacity, in entries
+ * @tparam Compare the comparator ordering the keys
+ */
+template <typename K, typename V, std::size_t maxSize, typename Compare = std::less<K>>
+class StaticFlatMap {
+public:
+    /**
+     * @name Constructors and destructors
+     */
+    ///@{
+
+    /**
+     * @brief Default constructor, initializes an empty map
+     *
+     * @param compare the comparator instance to order the keys with
+     */
+    constexpr StaticFlatMap(Compare compare = Compare()) noexcept
+        : m_compare(std::move(compare))
+    {
+    }
+
+    ///@}
+
+    /**
+     * @name Size getters
+     */
+    ///@{
+
+    /**
+     * @brief Gets the map capacity, in number of entries
+     *
+     * @return capacity in number of entries
+     */
+    [[nodiscard]] constexpr size_t GetCapacity() const noexcept
+    {
+        return maxSize;
+    }
+
+    /**
+     * @brief Gets the count of entries currently stored in the map
+     *
+     * @return entries count
+     */
+    [[nodiscard]] constexpr size_t GetSize() const noexcept
+    {
+        return m_keys.GetSize();
+    }
+
+    /**
+     * @brief Checks, if the map is currently empty
+     *
+     * @return true if it is empty,
+     * @return false otherwise
+     */
+    [[nodiscard]] constexpr bool IsEmpty() const noexcept
+    {
+        return m_keys.IsEmpty();
+    }
+
+    ///@}
+
+    /**
+     * @name Operations
+     */
+    ///@{
+
+    /**
+     * @brief Finds the value mapped to a key
+     *
+     * @param key the key to search for
+     * @return pointer to the value, or nullptr if the key is not present
+     */
+    [[nodiscard]] constexpr V* Find(const K& key) noexcept
+    {
+        const size_t index = IndexOf(key);
+        return index < m_keys.GetSize() ? &m_values[index] : nullptr;
+    }
+
+    /**
+     * @brief Finds the value mapped to a key
+     *
+     * @param key the key to search for
+     * @return const pointer to the value, or nullptr if the key is not present
+     */
+    [[nodiscard]] constexpr const V* Find(const K& key) const noexcept
+    {
+        const size_t index = IndexOf(key);
+        return index < m_keys.GetSize() ? &m_values[index] : nullptr;
+    }
+
+    /**
+     * @brief Checks, if the map contains a key
+     *
+     * @param key the key to search for
+     * @return true if the key is present,
+     * @return false otherwise
+     */
+    [[nodiscard]] constexpr bool Contains(const K& key) const noexcept
+    {
+        return IndexOf(key) < m_keys.GetSize();
+    }
+
+    /**
+     * @brief Maps a value to a key, replacing the value already mapped to it
+     *
+     * @tparam U type of the value, V must be constructible and assignable from it
+     * @param key the key
+     * @param value the value
+     * @return true, if the operation succeeded (the key was present or
+     *         the map wasn't full),
+     * @return false otherwise
+     */
+    template <typename U>
+    constexpr bool InsertOrAssign(const K& key, U&& value) noexcept
+    {
+        const size_t index = LowerBound(key);
+
+        if (index < m_keys.GetSize() && !m_compare(key, m_keys[index])) {
+            m_values[index] = std::forward<U>(value);
+            return true;
+        }
+
+        if (m_keys.GetSize() == maxSize) {
+            return false;
+        }
+
+        m_keys.Insert(index, key);
+        m_values.Insert(index, std::forward<U>(value));
+        return true;
+    }
+
+    /**
+     * @brief Removes the entry with the given key
+     *
+     * @param key the key of the entry to be removed
+     * @return true, if the operation succeeded (the key was present),
+     * @return false otherwise
+     */
+    constexpr bool Erase(const K& key) noexcept
+    {
+        const size_t index = IndexOf(key);
+
+        if (index == m_keys.GetSize()) {
+            return false;
+        }
+
+        m_keys.RemoveIndex(index);
+        m_values.RemoveIndex(index);
+        return true;
+    }
+
+    /**
+     * @brief Clears the map
+     */
+    constexpr void Clear() noexcept
+    {
+        m_keys.Clear();
+        m_values.Clear();
+    }
+
+    /**
+     * @brief Replaces the map contents with a range of key-value pairs,
+     *        sorting them in bulk
+     *
+     * If a key occurs more than once, the last occurrence wins, just like
+     * with a sequence of InsertOrAssign() calls. Once the map is full, pairs
+     * with new keys are dropped, while those with present keys still update
+     * their values.
+     *
+     * @tparam It forward iterator type, must dereference to a pair-like type
+     *            with `first` and `second` members
+     * @param first an iterator to the beginning of the range
+     * @param last an iterator to the end of the range
+     * @return the number of entries in the map
+     */
+    template <typename It>
+    constexpr size_t BuildFrom(It first, It last) noexcept
+    {
+        Clear();
+
+        // Merging duplicates may free up room for more pairs,
+        // so keep appending until the map is full of unique keys
+        for (;;) {
+            for (; first != last && m_keys.GetSize() < maxSize; ++first) {
+                m_keys.Append((*first).first);
+                m_values.Append((*first).second);
+            }
+
+            const size_t appended = m_keys.GetSize();
+            if (SortAndMerge() == appended || first == last) {
+                break;
+            }
+        }
+
+        // The remaining pairs can only update keys that are already present
+        for (; first != last; ++first) {
+            const size_t index = IndexOf((*first).first);
+
+            if (index != m_keys.GetSize()) {
+                m_values[index] = (*first).second;
+            }
+        }
+
+        return m_keys.GetSize();
+    }
+
+    /**
+     * @brief Gets all the keys, in ascending order
+     *
+     * @return a span over the keys
+     */
+    [[nodiscard]] constexpr std::span<const K> GetKeys() const noexcept
+    {
+        return { m_keys.begin(), m_keys.end() };
+    }
+
+    /**
+     * @brief Gets all the values, in the order of their keys
+     *
+     * @return a span over the values
+     */
+    [[nodiscard]] constexpr std::span<V> GetValues() noexcept
+    {
+        return { m_values.begin(), m_values.end() };
+    }
+
+    /**
+     * @brief Gets all the values, in the order of their keys
+     *
+     * @return a span over the values
+     */
+    [[nodiscard]] constexpr std::span<const V> GetValues() const noexcept
+    {
+        return { m_values.begin(), m_values.end() };
+    }
+
+    ///@}
+
+private:
+    /**
+     * @brief The smallest unsigned type able to hold an entry index
+     */
+    using IndexType = MinimalSizeType<maxSize>;
+
+    StaticVector<K, maxSize> m_keys;
+    StaticVector<V, maxSize> m_values;
+    [[no_unique_address]] Compare m_compare;
+
+    constexpr size_t LowerBound(const K& key) const noexcept
+    {
+        return BranchlessLowerBound(m_keys.begin(), m_keys.GetSize(), key, m_compare);
+    }
+
+    /**
+     * @brief Gets the index of a key, or the size of the map if it is not present
+     */
+    constexpr size_t IndexOf(const K& key) const noexcept
+    {
+        const size_t index = LowerBound(key);
+
+        if (index < m_keys.GetSize() && !m_compare(key, m_keys[index])) {
+            return index;
+        }
+
+        return m_keys.GetSize();
+    }
+
+    /**
+     * @brief Sorts the entries by key, keeping only the last of each run
+     *        of equal keys
+     *
+     * @return the number of entries left
+     */
+    constexpr size_t SortAndMerge() noexcept
+    {
+        const size_t count = m_keys.GetSize();
+
+        // Sort a permutation first, ties are broken by position,
+        // so that the last duplicate ends up last
+        StaticVector<IndexType, maxSize> order;
+        for (size_t i = 0; i < count; ++i) {
+            order.Append(static_cast<IndexType>(i));
+        }
+
+        std::sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+            return m_compare(m_keys[a], m_keys[b])
+                || (!m_compare(m_keys[b], m_keys[a]) && a < b);
+        });
+
+        ApplyPermutation(order);
+
+        // Keep only the last entry of each run of equal keys
+        size_t write_ptr = 0;
+        for (size_t read_ptr = 0; read_ptr < count; ++read_ptr) {
+            if (read_ptr + 1 < count && !m_compare(m_keys[read_ptr], m_keys[read_ptr + 1])) {
+                continue;
+            }
+
+            if (write_ptr != read_ptr) {
+                m_keys[write_ptr] = std::move(m_keys[read_ptr]);
+                m_values[write_ptr] = std::move(m_values[read_ptr]);
+            }
+            ++write_ptr;
+        }
+
+        m_keys.EraseRange(write_ptr, count);
+        m_values.EraseRange(write_ptr, count);
+        return write_ptr;
+    }
+
+    /**
+     * @brief Moves the entry at order[i] to position i for every i, following
+     *        the cycles of the permutation, which is consumed in the process
+     */
+    constexpr void ApplyPermutation(StaticVector<IndexType, maxSize>& order) noexcept
+    {
+        for (size_t i = 0; i < order.GetSize(); ++i) {
+            if (order[i] == i) {
+                continue;
+            }
+
+            K key = std::move(m_keys[i]);
+            V value = std::move(m_values[i]);
+
+            size_t j = i;
+            while (order[j] != i) {
+                const size_t next = order[j];
+                m_keys[j] = std::move(m_keys[next]);
+                m_values[j] = std::move(m_values[next]);
+                order[j] = static_cast<IndexType>(j);
+                j = next;
+            }
+
+            m_keys[j] = std::move(key);
+            m_values[j] = std::move(value);
+            order[j] = static_cast<IndexType>(j);
+        }
+    }
+};
+
+/**
+ * @brief A sorted set of unique keys, using only statically allocated memory.
+ *
+ * The keys are kept ordered in a StaticVector. Lookups use
+ * BranchlessLowerBound() and take O(log n), insertions and removals shift
+ * the following keys and take O(n). To fill the set with many keys
+ * at once, BuildFrom() sorts them just once.
+ *
+ * StaticFlatSet will never throw any exceptions.
+ *
+ * @tparam K the type of keys, must be ordered by Compare
+ * @tparam maxSize set capacity, in keys
+ * @tparam Compare the comparator ordering the keys
+ */
+template <typename K, std::size_t maxSize, typename Compare = std::less<K>>
+class StaticFlatSet {
+public:
+    /**
+     * @brief Bidirectional, random access const iterator to keys
+     */
+    using ConstIterator = const K*;
+
+    /**
+     * @name Constructors and destructors
+     */
+    ///@{
+
+    /**
+     * @brief Default constructor, initializes an empty set
+     *
+     * @param compare the comparator instance to order the keys with
+     */
+    constexpr StaticFlatSet(Compare compare = Compare()) noexcept
+        : m_compare(std::move(compare))
+    {
+    }
+
+    ///@}
+
+    /**
+     * @name Size getters
+     */
+    ///@{
+
+    /**
+     * @brief Gets the set capacity, in number of keys
+     *
+     * @return capacity in number of keys
+     */
+    [[nodiscard]] constexpr size_t GetCapacity() const noexcept
+    {
+        return maxSize;
+    }
+
+    /**
+     * @brief Gets the count of keys currently stored in the set
+     *
+     * @return keys count
+     */
+    [[nodiscard]] constexpr size_t GetSize() const noexcept
+    {
+        return m_keys.GetSize();
+    }
+
+    /**
+     * @brief Checks, if the set is currently empty
+     *
+     * @return true if it is empty,
+     * @return false otherwise
+     */
+    [[nodiscard]] constexpr bool IsEmpty() const noexcept
+    {
+        return m_keys.IsEmpty();
+    }
+
+    ///@}
+
+    /**
+     * @name Operations
+     */
+    ///@{
+
+    /**
+     * @brief Finds a key in the set
+     *
+     * @param key the key to search for
+     * @return pointer to the stored key, or nullptr if it is not present
+     */
+    [[nodiscard]] constexpr const K* Find(const K& key) const noexcept
+    {
+        const size_t index = IndexOf(key);
+        return index < m_keys.GetSize() ? &m_keys[index] : nullptr;
+    }
+
+    /**
+     * @brief Checks, if the set contains a key
+     *
+     * @param key the key to search for
+     * @return true if the key is present,
+     * @return false otherwise
+     */
+    [[nodiscard]] constexpr bool Contains(const K& key) const noexcept
+    {
+        return IndexOf(key) < m_keys.GetSize();
+    }
+
+    /**
+     * @brief Inserts a key into the set, unless it is already present
+     *
+     * @param key the key to be inserted
+     * @return true, if the operation succeeded (the key was present or
+     *         the set wasn't full),
+     * @return false otherwise
+     */
+    constexpr bool Insert(const K& key) noexcept
+    {
+        const size_t index = BranchlessLowerBound(m_keys.begin(), m_keys.GetSize(), key, m_compare);
+
+        if (index < m_keys.GetSize() && !m_compare(key, m_keys[index])) {
+            return true;
+        }
+
+        return m_keys.Insert(index, key);
+    }
+
+    /**
+     * @brief Removes a key from the set
+     *
+     * @param key the key to be removed
+     * @return true, if the operation succeeded (the key was present),
+     * @return false otherwise
+     */
+    constexpr bool Erase(const K& key) noexcept
+    {
+        const size_t index = IndexOf(key);
+        return index < m_keys.GetSize() && m_keys.RemoveIndex(index);
+    }
+
+    /**
+     * @brief Clears the set
+     */
+    constexpr void Clear() noexcept
+    {
+        m_keys.Clear();
+    }
+
+    /**
+     * @brief Replaces the set contents with a range of keys, sorting them
+     *        in bulk
+     *
+     * Duplicate keys are stored once. Once the set is full, new keys are
+     * dropped, just like with a sequence of Insert() calls.
+     *
+     * @tparam It forward iterator type, must dereference to K
+     * @param first an iterator to the beginning of the range
+     * @param last an iterator to the end of the range
+     * @return the number of keys in the set
+     */
+    template <typename It>
+    constexpr size_t BuildFrom(It first, It last) noexcept
+    {
+        Clear();
+
+        // Removing duplicates may free up room for more keys,
+        // so keep appending until the set is full of unique keys
+        for (;;) {
+            for (; first != last && m_keys.GetSize() < maxSize; ++first) {
+                m_keys.Append(*first);
+            }
+
+            const size_t appended = m_keys.GetSize();
+            if (SortAndDeduplicate() == appended || first == last) {
+                break;
+            }
+        }
+
+        return m_keys.GetSize();
+    }
+
+    /**
+     * @brief Returns an iterator to the smallest key
+     *
+     * @return iterator object
+     */
+    [[nodiscard]] constexpr ConstIterator begin() const noexcept
+    {
+        return m_keys.begin();
+    }
+
+    /**
+     * @brief Returns an iterator past the largest key
+     *
+     * @return iterator object
+     */
+    [[nodiscard]] constexpr ConstIterator end() const noexcept
+    {
+        return m_keys.end();
+    }
+
+    ///@}
+
+private:
+    StaticVector<K, maxSize> m_keys;
+    [[no_unique_address]] Compare m_compare;
+
+    /**
+     * @brief Gets the index of a key, or the size of the set if it is not present
+     */
+    constexpr size_t IndexOf(const K& key) const noexcept
+    {
+        const size_t index = BranchlessLowerBound(m_keys.begin(), m_keys.GetSize(), key, m_compare);
+
+        if (index < m_keys.GetSize() && !m_compare(key, m_keys[index])) {
+            return index;
+        }
+
+        return m_keys.GetSize();
+    }
+
+    /**
+     * @brief Sorts the keys, keeping only the first of each run of equal keys
+     *
+     * @return the number of keys left
+     */
+    constexpr size_t SortAndDeduplicate() noexcept
+    {
+        std::sort(m_keys.begin(), m_keys.end(), m_compare);
+
+        size_t write_ptr = 0;
+        for (size_t read_ptr = 0; read_ptr < m_keys.GetSize(); ++read_ptr) {
+            if (write_ptr > 0 && !m_compare(m_keys[write_ptr - 1], m_keys[read_ptr])) {
+                continue;
+            }
+
+            if (write_ptr != read_ptr) {
+                m_keys[write_ptr] = std::move(m_keys[read_ptr]);
+            }
+            ++write_ptr;
+        }
+
+        m_keys.EraseRange(write_ptr, m_keys.GetSize());
+        return write_ptr;
+    }
+};
+
+};
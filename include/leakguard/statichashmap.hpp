@@ -0,0 +1,542 @@
+#pragma once
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "hash.hpp"
+#include "sizetype.hpp"
+#include "staticstring.hpp"
+#include "staticstringview.hpp"
+
+namespace lg {
+
+/**
+ * @brief The default hash used by StaticHashMap
+ *
+ * Falls back to std::hash, StaticHashMap scrambles the result anyway,
+ * so even an identity hash of integers spreads well.
+ *
+ * @tparam K the type of keys
+ */
+template <typename K>
+struct StaticHash : std::hash<K> { };
+
+/**
+ * @brief The default hash of StaticString keys, see Hash()
+ *
+ * @tparam maxSize capacity of the hashed strings
+ */
+template <std::size_t maxSize>
+struct StaticHash<StaticString<maxSize>> {
+    size_t operator()(const StaticString<maxSize>& string) const noexcept
+    {
+        return Hash(string);
+    }
+};
+
+/**
+ * @brief The default hash of StaticStringView keys, see Hash()
+ */
+template <>
+struct StaticHash<StaticStringView> {
+    size_t operator()(StaticStringView view) const noexcept
+    {
+        return Hash(view);
+    }
+};
+
+/**
+ * @brief The default hash of HashedStaticString keys, returns the cached hash
+ *
+ * @tparam maxSize capacity of the hashed strings
+ */
+template <std::size_t maxSize>
+struct StaticHash<HashedStaticString<maxSize>> {
+    size_t operator()(const HashedStaticString<maxSize>& string) const noexcept
+    {
+        return string.GetHash();
+    }
+};
+
+/**
+ * @brief Computes the default bucket count of StaticHashMap, the smallest
+ *        power of two keeping the load factor at or below 7/8
+ *
+ * @param maxSize the number of entries to be held
+ * @return the bucket count
+ */
+inline constexpr size_t DefaultHashMapBucketCount(size_t maxSize) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+    return std::bit_ceil((maxSize * 8 + 6) / 7 + 1);
+}
+
+/**
+ * @brief An unordered associative container mapping unique keys to values,
+ *        using only statically allocated memory.
+ *
+ * The map uses open addressing with Robin Hood hashing: every bucket knows
+ * how far it is from the bucket its key hashes to, and an insertion takes
+ * the place of any entry that is closer to its own bucket. That keeps probe
+ * sequences short and lets a lookup stop as soon as it reaches an entry
+ * closer to home than the searched key would be. Removal shifts
+ * the following entries back by one bucket, so there are no tombstones
+ * and the map never degrades after many insertions and removals.
+ *
+ * The probe distances are stored apart from keys and values, so probing
+ * mostly touches the small distance array. The hash is scrambled with
+ * a Fibonacci multiplication before it picks a bucket.
+ *
+ * The storage is left uninitialized, keys and values are constructed on
+ * insertion and destroyed on removal.
+ *
+ * StaticHashMap will never throw any exceptions.
+ *
+ * @tparam K the type of keys
+ * @tparam V the type of values
+ * @tparam maxSize map capacity, in entries
+ * @tparam Hash the hash of keys
+ * @tparam KeyEqual the equality comparison of keys
+ * @tparam bucketCount number of buckets, must be a power of two and keep
+ *                     the load factor at or below 7/8
+ */
+template <typename K, typename V, std::size_t maxSize, typename Hash = StaticHash<K>,
+    typename KeyEqual = std::equal_to<K>,
+    std::size_t bucketCount = DefaultHashMapBucketCount(maxSize)>
+class StaticHashMap {
+public:
+    static_assert(maxSize > 0, "map capacity must be greater than 0");
+    static_assert((bucketCount & (bucketCount - 1)) == 0,
+        "bucket count must be a power of two");
+    static_assert(maxSize * 8 <= bucketCount * 7,
+        "load factor must not exceed 7/8, increase the bucket count");
+
+    /**
+     * @name Constructors and destructors
+     */
+    ///@{
+
+    /**
+     * @brief Default constructor, initializes an empty map
+     *
+     * @param hash the hash instance
+     * @param keyEqual the key equality comparison instance
+     */
+    StaticHashMap(Hash hash = Hash(), KeyEqual keyEqual = KeyEqual()) noexcept
+        : m_hash(std::move(hash))
+        , m_keyEqual(std::move(keyEqual))
+    {
+    }
+
+    /**
+     * @brief Copy constructor, copies all entries of another map
+     *
+     * @param other map to copy entries from
+     */
+    StaticHashMap(const StaticHashMap& other) noexcept
+        : m_hash(other.m_hash)
+        , m_keyEqual(other.m_keyEqual)
+    {
+        CopyFrom(other);
+    }
+
+    /**
+     * @brief Move constructor, moves all entries of another map
+     *
+     * The other map is left empty.
+     *
+     * @param other map to move entries from
+     */
+    StaticHashMap(StaticHashMap&& other) noexcept
+        : m_hash(other.m_hash)
+        , m_keyEqual(other.m_keyEqual)
+    {
+        MoveFrom(other);
+    }
+
+    /**
+     * @brief Destructor, destroys all the entries
+     */
+    ~StaticHashMap()
+    {
+        Clear();
+    }
+
+    /**
+     * @brief Trivial destructor for trivially destructible keys and values
+     */
+    ~StaticHashMap()
+        requires(std::is_trivially_destructible<K>::value
+            && std::is_trivially_destructible<V>::value)
+    = default;
+
+    ///@}
+
+    /**
+     * @name Operators
+     */
+    ///@{
+
+    /**
+     * @brief Assignment operator, copies all entries of another map
+     *
+     * @param other the instance of the second map
+     * @return reference to self
+     */
+    StaticHashMap& operator=(const StaticHashMap& other) noexcept
+    {
+        if (this != &other) {
+            Clear();
+            CopyFrom(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator, moves all entries of another map
+     *
+     * The other map is left empty, unless it is this map.
+     *
+     * @param other the instance of the second map
+     * @return reference to self
+     */
+    StaticHashMap& operator=(StaticHashMap&& other) noexcept
+    {
+        if (this != &other) {
+            Clear();
+            MoveFrom(other);
+        }
+
+        return *this;
+    }
+
+    ///@}
+
+    /**
+     * @name Size getters
+     */
+    ///@{
+
+    /**
+     * @brief Gets the map capacity, in number of entries
+     *
+     * @return capacity in number of entries
+     */
+    [[nodiscard]] constexpr size_t GetCapacity() const noexcept
+    {
+        return maxSize;
+    }
+
+    /**
+     * @brief Gets the number of buckets
+     *
+     * @return bucket count
+     */
+    [[nodiscard]] constexpr size_t GetBucketCount() const noexcept
+    {
+        return bucketCount;
+    }
+
+    /**
+     * @brief Gets the count of entries currently stored in the map
+     *
+     * @return entries count
+     */
+    [[nodiscard]] size_t GetSize() const noexcept
+    {
+        return m_currentSize;
+    }
+
+    /**
+     * @brief Checks, if the map is currently empty
+     *
+     * @return true if it is empty,
+     * @return false otherwise
+     */
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return m_currentSize == 0;
+    }
+
+    ///@}
+
+    /**
+     * @name Operations
+     */
+    ///@{
+
+    /**
+     * @brief Finds the value mapped to a key
+     *
+     * @param key the key to search for
+     * @return pointer to the value, or nullptr if the key is not present
+     */
+    [[nodiscard]] V* Find(const K& key) noexcept
+    {
+        const size_t index = IndexOf(key);
+        return index < bucketCount ? &m_values[index] : nullptr;
+    }
+
+    /**
+     * @brief Finds the value mapped to a key
+     *
+     * @param key the key to search for
+     * @return const pointer to the value, or nullptr if the key is not present
+     */
+    [[nodiscard]] const V* Find(const K& key) const noexcept
+    {
+        const size_t index = IndexOf(key);
+        return index < bucketCount ? &m_values[index] : nullptr;
+    }
+
+    /**
+     * @brief Checks, if the map contains a key
+     *
+     * @param key the key to search for
+     * @return true if the key is present,
+     * @return false otherwise
+     */
+    [[nodiscard]] bool Contains(const K& key) const noexcept
+    {
+        return IndexOf(key) < bucketCount;
+    }
+
+    /**
+     * @brief Maps a value to a key, replacing the value already mapped to it
+     *
+     * @tparam U type of the value, V must be constructible and assignable from it
+     * @param key the key
+     * @param value the value
+     * @return true, if the operation succeeded (the key was present or
+     *         the map wasn't full),
+     * @return false otherwise
+     */
+    template <typename U>
+    bool InsertOrAssign(const K& key, U&& value) noexcept
+    {
+        size_t index = HomeBucket(key);
+        size_t distance = 1;
+
+        // Robin Hood invariant: the key can't be past an entry closer to home
+        while (m_distances[index] >= distance) {
+            if (m_distances[index] == distance && m_keyEqual(m_keys[index], key)) {
+                m_values[index] = std::forward<U>(value);
+                return true;
+            }
+
+            index = (index + 1) & (bucketCount - 1);
+            ++distance;
+        }
+
+        if (m_currentSize == maxSize) {
+            return false;
+        }
+
+        K carriedKey(key);
+        V carriedValue(std::forward<U>(value));
+
+        while (m_distances[index] != 0) {
+            if (m_distances[index] < distance) {
+                std::swap(carriedKey, m_keys[index]);
+                std::swap(carriedValue, m_values[index]);
+                distance = std::exchange(m_distances[index],
+                    static_cast<DistanceType>(distance));
+            }
+
+            index = (index + 1) & (bucketCount - 1);
+            ++distance;
+        }
+
+        std::construct_at(&m_keys[index], std::move(carriedKey));
+        std::construct_at(&m_values[index], std::move(carriedValue));
+        m_distances[index] = static_cast<DistanceType>(distance);
+        ++m_currentSize;
+
+        return true;
+    }
+
+    /**
+     * @brief Removes the entry with the given key
+     *
+     * @param key the key of the entry to be removed
+     * @return true, if the operation succeeded (the key was present),
+     * @return false otherwise
+     */
+    bool Erase(const K& key) noexcept
+    {
+        size_t index = IndexOf(key);
+
+        if (index == bucketCount) {
+            return false;
+        }
+
+        DestroyEntry(index);
+
+        // Shift the following entries back, until one is already at home
+        size_t next = (index + 1) & (bucketCount - 1);
+        while (m_distances[next] > 1) {
+            std::construct_at(&m_keys[index], std::move(m_keys[next]));
+            std::construct_at(&m_values[index], std::move(m_values[next]));
+            m_distances[index] = static_cast<DistanceType>(m_distances[next] - 1);
+            DestroyEntry(next);
+
+            index = next;
+            next = (next + 1) & (bucketCount - 1);
+        }
+
+        --m_currentSize;
+        return true;
+    }
+
+    /**
+     * @brief Clears the map
+     */
+    void Clear() noexcept
+    {
+        for (size_t i = 0; i < bucketCount && m_currentSize > 0; ++i) {
+            if (m_distances[i] != 0) {
+                DestroyEntry(i);
+                --m_currentSize;
+            }
+        }
+    }
+
+    /**
+     * @brief Calls a function for every entry, in unspecified order
+     *
+     * The map must not be modified during the call, apart from
+     * the values themselves.
+     *
+     * @tparam F a callable taking (const K&, V&)
+     * @param function the function to be called
+     */
+    template <typename F>
+    void ForEach(F function) noexcept
+    {
+        for (size_t i = 0; i < bucketCount; ++i) {
+            if (m_distances[i] != 0) {
+                function(std::as_const(m_keys[i]), m_values[i]);
+            }
+        }
+    }
+
+    /**
+     * @brief Calls a function for every entry, in unspecified order
+     *
+     * @tparam F a callable taking (const K&, const V&)
+     * @param function the function to be called
+     */
+    template <typename F>
+    void ForEach(F function) const noexcept
+    {
+        for (size_t i = 0; i < bucketCount; ++i) {
+            if (m_distances[i] != 0) {
+                function(m_keys[i], m_values[i]);
+            }
+        }
+    }
+
+    ///@}
+
+private:
+    /**
+     * @brief Probe distance of an entry plus one, 0 marks an empty bucket
+     */
+    using DistanceType = MinimalSizeType<bucketCount>;
+
+    std::array<DistanceType, bucketCount> m_distances {};
+
+    // Uninitialized storage, entries are constructed and destroyed in place
+    union {
+        K m_keys[bucketCount]; // NOLINT(*-avoid-c-arrays)
+    };
+
+    union {
+        V m_values[bucketCount]; // NOLINT(*-avoid-c-arrays)
+    };
+
+    MinimalSizeType<maxSize> m_currentSize { 0 };
+    [[no_unique_address]] Hash m_hash;
+    [[no_unique_address]] KeyEqual m_keyEqual;
+
+    /**
+     * @brief Picks the bucket a key hashes to, using the top bits of
+     *        the hash multiplied by 2^N / phi
+     */
+    size_t HomeBucket(const K& key) const noexcept
+    {
+        if constexpr (bucketCount == 1) {
+            return 0;
+        } else {
+            static constexpr unsigned SHIFT
+                = sizeof(size_t) * 8 - std::countr_zero(bucketCount);
+            static constexpr size_t MULTIPLIER = sizeof(size_t) == 8
+                ? static_cast<size_t>(0x9E3779B97F4A7C15ULL)
+                : static_cast<size_t>(0x9E3779B9UL);
+
+            return (static_cast<size_t>(m_hash(key)) * MULTIPLIER) >> SHIFT;
+        }
+    }
+
+    /**
+     * @brief Gets the bucket of a key, or bucketCount if it is not present
+     */
+    size_t IndexOf(const K& key) const noexcept
+    {
+        size_t index = HomeBucket(key);
+        size_t distance = 1;
+
+        while (m_distances[index] >= distance) {
+            if (m_distances[index] == distance && m_keyEqual(m_keys[index], key)) {
+                return index;
+            }
+
+            index = (index + 1) & (bucketCount - 1);
+            ++distance;
+        }
+
+        return bucketCount;
+    }
+
+    void DestroyEntry(size_t index) noexcept
+    {
+        std::destroy_at(&m_keys[index]);
+        std::destroy_at(&m_values[index]);
+        m_distances[index] = 0;
+    }
+
+    void CopyFrom(const StaticHashMap& other) noexcept
+    {
+        for (size_t i = 0; i < bucketCount; ++i) {
+            if (other.m_distances[i] != 0) {
+                std::construct_at(&m_keys[i], other.m_keys[i]);
+                std::construct_at(&m_values[i], other.m_values[i]);
+            }
+        }
+
+        m_distances = other.m_distances;
+        m_currentSize = other.m_currentSize;
+    }
+
+    void MoveFrom(StaticHashMap& other) noexcept
+    {
+        for (size_t i = 0; i < bucketCount; ++i) {
+            if (other.m_distances[i] != 0) {
+                std::construct_at(&m_keys[i], std::move(other.m_keys[i]));
+                std::construct_at(&m_values[i], std::move(other.m_values[i]));
+            }
+        }
+
+        m_distances = other.m_distances;
+        m_currentSize = other.m_currentSize;
+        other.Clear();
+    }
+};
+
+};
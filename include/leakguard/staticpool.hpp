@@ -0,0 +1,455 @@
+#pragma once
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "mutex.hpp"
+#include "sizetype.hpp"
+
+namespace lg {
+
+/**
+ * @brief A fixed-size object pool, using only statically allocated memory.
+ *
+ * Objects are constructed in place by Allocate() and destroyed by Free(),
+ * both in constant time. An object never moves while it is allocated, so
+ * pointers and handles to it stay valid until it is freed, no matter how
+ * many other objects come and go.
+ *
+ * Freed slots form an intrusive singly linked list: the link is stored
+ * in the slot itself, in place of the destroyed object, so the free list
+ * costs no memory. Slots that have never been used are taken in order from
+ * the end of the used part, so the pool needs no initialization pass.
+ *
+ * With `checkGenerations` enabled, every slot counts its allocations
+ * and frees. Handles carry the count from the time they were created,
+ * so Get() returns nullptr for a handle whose object has been freed, even
+ * if the slot has been reused since. Freeing an object twice is detected
+ * and rejected as well.
+ *
+ * Allocate() and Free() lock the mutex only around the free list and
+ * generation updates, objects are constructed and destroyed outside of it.
+ * With generations, Free() marks the slot as freed before destroying the
+ * object, so concurrent double frees are rejected too. The rest of the API
+ * is not synchronized.
+ *
+ * StaticPool will never throw any exceptions.
+ *
+ * @tparam T the type of objects being stored
+ * @tparam size pool capacity
+ * @tparam MutexImpl_t the chosen mutex implementation
+ * @tparam checkGenerations whether to track slot generations to detect
+ *                          stale handles and double frees
+ */
+template <typename T, std::size_t size, typename MutexImpl_t = NopMutexImpl,
+    bool checkGenerations = true>
+class StaticPool {
+private:
+    /**
+     * @brief Slot index type, `size` itself is the null index
+     */
+    using IndexType = MinimalSizeType<size>;
+
+    /**
+     * @brief An empty stand-in for generation counters, used when
+     *        checkGenerations is disabled
+     */
+    struct NoGeneration {
+        bool operator==(const NoGeneration&) const = default;
+    };
+
+    /**
+     * @brief Generation counter type, odd values mark allocated slots
+     */
+    using GenerationType = std::conditional_t<checkGenerations, std::uint32_t, NoGeneration>;
+
+public:
+    static_assert(size > 0, "pool capacity must be greater than 0");
+
+    /**
+     * @brief A stable reference to an allocated object
+     */
+    struct Handle {
+        /**
+         * @brief The index of the slot holding the object
+         */
+        IndexType index { static_cast<IndexType>(size) };
+
+        /**
+         * @brief The generation of the slot at the time of allocation
+         */
+        [[no_unique_address]] GenerationType generation {};
+
+        bool operator==(const Handle&) const = default;
+    };
+
+    /**
+     * @name Constructors and destructors
+     */
+    ///@{
+
+    /**
+     * @brief Default constructor, initializes an empty pool
+     *
+     * @param mutexImpl the mutex instance
+     */
+    StaticPool(MutexImpl_t mutexImpl = MutexImpl_t()) noexcept(
+        std::is_nothrow_constructible<MutexImpl_t, const MutexImpl_t&>::value)
+        : m_mutexImpl(std::move(mutexImpl))
+    {
+    }
+
+    StaticPool(const StaticPool&) = delete;
+    StaticPool(StaticPool&&) = delete;
+    StaticPool& operator=(const StaticPool&) = delete;
+    StaticPool& operator=(StaticPool&&) = delete;
+
+    /**
+     * @brief Destructor, destroys all the objects still allocated
+     */
+    ~StaticPool()
+    {
+        Clear();
+    }
+
+    ///@}
+
+    /**
+     * @name Size getters
+     */
+    ///@{
+
+    /**
+     * @brief Gets the pool capacity, in number of objects
+     *
+     * @return capacity in number of objects
+     */
+    [[nodiscard]] constexpr size_t GetCapacity() const noexcept
+    {
+        return size;
+    }
+
+    /**
+     * @brief Gets the count of objects currently allocated
+     *
+     * @return allocated objects count
+     */
+    [[nodiscard]] size_t GetSize() const noexcept
+    {
+        return m_currentSize;
+    }
+
+    /**
+     * @brief Checks, if no objects are currently allocated
+     *
+     * @return true if it is empty,
+     * @return false otherwise
+     */
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return m_currentSize == 0;
+    }
+
+    /**
+     * @brief Checks, if all the slots are currently allocated
+     *
+     * @return true if it is full,
+     * @return false otherwise
+     */
+    [[nodiscard]] bool IsFull() const noexcept
+    {
+        return m_currentSize == size;
+    }
+
+    ///@}
+
+    /**
+     * @name Allocation
+     */
+    ///@{
+
+    /**
+     * @brief Allocates a slot and constructs an object in it
+     *
+     * @tparam Args types of the constructor arguments
+     * @param args arguments forwarded to the constructor of T
+     * @return pointer to the new object, or nullptr if the pool is full
+     */
+    template <typename... Args>
+    T* Allocate(Args&&... args) noexcept
+    {
+        size_t index = size;
+
+        {
+            auto lock = AcquireMutex();
+
+            if (m_freeHead != size) {
+                index = m_freeHead;
+                m_freeHead = m_slots[index].nextFree;
+            } else if (m_usedSlots != size) {
+                index = m_usedSlots++;
+            } else {
+                return nullptr;
+            }
+
+            if constexpr (checkGenerations) {
+                ++m_generations[index];
+            }
+
+            ++m_currentSize;
+        }
+
+        return std::construct_at(&m_slots[index].value, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Destroys an object and returns its slot to the pool
+     *
+     * @param object pointer to the object, as returned by Allocate()
+     * @return true, if the operation succeeded (the object belongs
+     *         to this pool and, with generations, is still allocated),
+     * @return false otherwise
+     */
+    bool Free(T* object) noexcept
+    {
+        if (!Owns(object)) {
+            return false;
+        }
+
+        const size_t index = IndexOf(object);
+
+        // Mark the slot as freed first, so that a concurrent second
+        // Free() of the same object fails instead of destroying it again
+        if constexpr (checkGenerations) {
+            auto lock = AcquireMutex();
+
+            if (!IsAllocated(index)) {
+                return false;
+            }
+
+            ++m_generations[index];
+        }
+
+        std::destroy_at(object);
+
+        auto lock = AcquireMutex();
+        Release(index);
+        return true;
+    }
+
+    /**
+     * @brief Destroys the object referenced by a handle and returns its
+     *        slot to the pool
+     *
+     * @param handle handle of the object
+     * @return true, if the operation succeeded (the handle is not stale),
+     * @return false otherwise
+     */
+    bool Free(Handle handle) noexcept
+    {
+        T* object = Get(handle);
+        return object != nullptr && Free(object);
+    }
+
+    /**
+     * @brief Destroys all the allocated objects
+     *
+     * All the pointers and handles to them become invalid.
+     */
+    void Clear() noexcept
+    {
+        auto lock = AcquireMutex();
+
+        if constexpr (checkGenerations) {
+            for (size_t i = 0; i < m_usedSlots; ++i) {
+                if (IsAllocated(i)) {
+                    std::destroy_at(&m_slots[i].value);
+                    ++m_generations[i];
+                }
+            }
+        } else if constexpr (!std::is_trivially_destructible<T>::value) {
+            std::bitset<size> freeSlots;
+            for (size_t i = m_freeHead; i != size; i = m_slots[i].nextFree) {
+                freeSlots.set(i);
+            }
+
+            for (size_t i = 0; i < m_usedSlots; ++i) {
+                if (!freeSlots.test(i)) {
+                    std::destroy_at(&m_slots[i].value);
+                }
+            }
+        }
+
+        m_freeHead = static_cast<IndexType>(size);
+        m_usedSlots = 0;
+        m_currentSize = 0;
+    }
+
+    ///@}
+
+    /**
+     * @name Handles
+     */
+    ///@{
+
+    /**
+     * @brief Gets a stable handle to an allocated object
+     *
+     * @param object pointer to the object, as returned by Allocate()
+     * @return handle of the object, or a null handle if the object
+     *         does not belong to this pool
+     */
+    [[nodiscard]] Handle GetHandle(const T* object) const noexcept
+    {
+        if (!Owns(object)) {
+            return Handle {};
+        }
+
+        const size_t index = IndexOf(object);
+        Handle handle { static_cast<IndexType>(index) };
+
+        if constexpr (checkGenerations) {
+            handle.generation = m_generations[index];
+        }
+
+        return handle;
+    }
+
+    /**
+     * @brief Gets the object referenced by a handle
+     *
+     * Without generations, stale handles can not be detected and
+     * return whatever object occupies the slot.
+     *
+     * @param handle handle of the object
+     * @return pointer to the object, or nullptr if the handle is null or stale
+     */
+    [[nodiscard]] T* Get(Handle handle) noexcept
+    {
+        if (handle.index >= size) {
+            return nullptr;
+        }
+
+        if constexpr (checkGenerations) {
+            if (m_generations[handle.index] != handle.generation
+                || !IsAllocated(handle.index)) {
+                return nullptr;
+            }
+        }
+
+        return &m_slots[handle.index].value;
+    }
+
+    /**
+     * @brief Gets the object referenced by a handle
+     *
+     * @param handle handle of the object
+     * @return const pointer to the object, or nullptr if the handle is null or stale
+     */
+    [[nodiscard]] const T* Get(Handle handle) const noexcept
+    {
+        return const_cast<StaticPool*>(this)->Get(handle); // NOLINT(*-const-cast)
+    }
+
+    /**
+     * @brief Checks, if a pointer points to a slot of this pool
+     *
+     * @param object the pointer
+     * @return true if it belongs to this pool,
+     * @return false otherwise
+     */
+    [[nodiscard]] bool Owns(const T* object) const noexcept
+    {
+        // NOLINTNEXTLINE(*-reinterpret-cast)
+        const auto* slot = reinterpret_cast<const Slot*>(object);
+        return !std::less<const Slot*> {}(slot, std::begin(m_slots))
+            && std::less<const Slot*> {}(slot, std::end(m_slots));
+    }
+
+    ///@}
+
+private:
+    /**
+     * @brief A pool slot, holding either an object or a free list link
+     */
+    union Slot {
+        Slot() noexcept { }
+        ~Slot() { }
+
+        Slot(const Slot&) = delete;
+        Slot(Slot&&) = delete;
+        Slot& operator=(const Slot&) = delete;
+        Slot& operator=(Slot&&) = delete;
+
+        T value;
+        IndexType nextFree;
+    };
+
+    Slot m_slots[size]; // NOLINT(*-avoid-c-arrays)
+    [[no_unique_address]] std::conditional_t<checkGenerations,
+        std::array<GenerationType, size>, NoGeneration> m_generations {};
+
+    IndexType m_freeHead { static_cast<IndexType>(size) };
+    IndexType m_usedSlots { 0 };
+    IndexType m_currentSize { 0 };
+    [[no_unique_address]] mutable MutexImpl_t m_mutexImpl;
+
+    size_t IndexOf(const T* object) const noexcept
+    {
+        // NOLINTNEXTLINE(*-reinterpret-cast)
+        return static_cast<size_t>(reinterpret_cast<const Slot*>(object) - std::begin(m_slots));
+    }
+
+    bool IsAllocated(size_t index) const noexcept
+        requires checkGenerations
+    {
+        return (m_generations[index] & 1U) != 0;
+    }
+
+    /**
+     * @brief Pushes a slot onto the free list, the mutex must be held
+     */
+    void Release(size_t index) noexcept
+    {
+        m_slots[index].nextFree = m_freeHead;
+        m_freeHead = static_cast<IndexType>(index);
+        --m_currentSize;
+    }
+
+    /**
+     * @brief A RAII wrapper over MutexImpl object
+     */
+    class MutexHolder {
+    public:
+        explicit MutexHolder(MutexImpl_t& mutex)
+            : m_mutex(mutex)
+        {
+            m_mutex.Lock();
+        }
+
+        ~MutexHolder()
+        {
+            m_mutex.Unlock();
+        }
+
+        MutexHolder(const MutexHolder&) = delete;
+        MutexHolder(MutexHolder&&) = delete;
+        MutexHolder& operator=(const MutexHolder&) = delete;
+        MutexHolder& operator=(MutexHolder&&) = delete;
+
+    private:
+        MutexImpl_t& m_mutex; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+    };
+
+    MutexHolder AcquireMutex() const
+    {
+        return MutexHolder(m_mutexImpl);
+    }
+};
+
+};
@@ -0,0 +1,494 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+#include "sizetype.hpp"
+#include "staticvector.hpp"
+
+namespace lg {
+
+/**
+ * @brief A priority queue, using only statically allocated memory.
+ *
+ * The elements are kept in a StaticVector laid out as an implicit d-ary
+ * heap, with the highest priority element at the top. Push(), Pop() and
+ * the handle operations take O(log n), Top() takes O(1), and Heapify()
+ * builds the queue from a whole range in O(n). A 4-ary heap is half as deep
+ * as a binary one, and the children of a node usually share a cache line,
+ * so it trades a few more comparisons per level for fewer levels.
+ *
+ * As with std::priority_queue, the top element is the one that compares
+ * greatest, e.g. std::greater puts the earliest deadline on top.
+ *
+ * Every element is given a handle when pushed, which can be used to look
+ * at it, change its priority or remove it while it is queued. A handle
+ * becomes invalid once its element leaves the queue, and may then be given
+ * to a newly pushed element.
+ *
+ * StaticPriorityQueue will never throw any exceptions.
+ *
+ * @tparam T the type of elements being stored
+ * @tparam maxSize queue capacity, in elements
+ * @tparam Compare the comparator, the element that compares greatest is on top
+ * @tparam arity the number of children of every heap node
+ */
+template <typename T, std::size_t maxSize, typename Compare = std::less<T>,
+    std::size_t arity = 4>
+class StaticPriorityQueue {
+private:
+    /**
+     * @brief Slot index type, `maxSize` itself is the null index
+     */
+    using IndexType = MinimalSizeType<maxSize>;
+
+public:
+    static_assert(maxSize > 0, "queue capacity must be greater than 0");
+    static_assert(arity >= 2, "heap arity must be at least 2");
+
+    /**
+     * @brief A stable reference to a queued element
+     */
+    struct Handle {
+        /**
+         * @brief The slot of the element
+         */
+        IndexType slot { static_cast<IndexType>(maxSize) };
+
+        bool operator==(const Handle&) const = default;
+    };
+
+    /**
+     * @name Constructors
+     */
+    ///@{
+
+    /**
+     * @brief Default constructor, initializes an empty queue
+     *
+     * @param compare the comparator instance to order the elements with
+     */
+    constexpr StaticPriorityQueue(Compare compare = Compare()) noexcept
+        : m_compare(std::move(compare))
+    {
+        for (size_t i = 0; i < maxSize; ++i) {
+            m_slots[i] = static_cast<IndexType>(i);
+            m_positions[i] = static_cast<IndexType>(i);
+        }
+    }
+
+    ///@}
+
+    /**
+     * @name Size getters
+     */
+    ///@{
+
+    /**
+     * @brief Gets the queue capacity, in number of elements
+     *
+     * @return capacity in number of elements
+     */
+    [[nodiscard]] constexpr size_t GetCapacity() const noexcept
+    {
+        return maxSize;
+    }
+
+    /**
+     * @brief Gets the count of elements currently queued
+     *
+     * @return elements count
+     */
+    [[nodiscard]] constexpr size_t GetSize() const noexcept
+    {
+        return m_heap.GetSize();
+    }
+
+    /**
+     * @brief Checks, if the queue is currently empty
+     *
+     * @return true if it is empty,
+     * @return false otherwise
+     */
+    [[nodiscard]] constexpr bool IsEmpty() const noexcept
+    {
+        return m_heap.IsEmpty();
+    }
+
+    ///@}
+
+    /**
+     * @name Operations
+     */
+    ///@{
+
+    /**
+     * @brief Gets the highest priority element
+     *
+     * In DEBUG mode additional bound checks are performed.
+     *
+     * @return const reference to the element
+     */
+    [[nodiscard]] constexpr const T& Top() const noexcept
+    {
+        return m_heap[0];
+    }
+
+    /**
+     * @brief Gets the handle of the highest priority element
+     *
+     * @return the handle, or a null handle if the queue is empty
+     */
+    [[nodiscard]] constexpr Handle GetTopHandle() const noexcept
+    {
+        return IsEmpty() ? Handle {} : Handle { m_slots[0] };
+    }
+
+    /**
+     * @brief Copies an element into the queue
+     *
+     * @param value the element to push
+     * @return the handle of the element, or a null handle if the queue is full
+     */
+    constexpr Handle Push(const T& value) noexcept
+    {
+        return Emplace(value);
+    }
+
+    /**
+     * @brief Moves an element into the queue
+     *
+     * @param value the element to push
+     * @return the handle of the element, or a null handle if the queue is full
+     */
+    constexpr Handle Push(T&& value) noexcept
+    {
+        return Emplace(std::move(value));
+    }
+
+    /**
+     * @brief Constructs an element in place in the queue
+     *
+     * @tparam Args types of the constructor arguments
+     * @param args arguments forwarded to the constructor of T
+     * @return the handle of the element, or a null handle if the queue is full
+     */
+    template <typename... Args>
+    constexpr Handle Emplace(Args&&... args) noexcept
+    {
+        const size_t position = m_heap.GetSize();
+        if (!m_heap.EmplaceBack(std::forward<Args>(args)...)) {
+            return Handle {};
+        }
+
+        const IndexType slot = m_slots[position];
+        SiftUp(position);
+        return Handle { slot };
+    }
+
+    /**
+     * @brief Removes the highest priority element
+     *
+     * @return true, if the operation succeeded (queue wasn't empty),
+     * @return false otherwise
+     */
+    constexpr bool Pop() noexcept
+    {
+        if (IsEmpty()) {
+            return false;
+        }
+
+        Erase(0);
+        return true;
+    }
+
+    /**
+     * @brief Retrieves the highest priority element and removes it
+     *
+     * If the queue is empty, the reference provided as an argument stays
+     * untouched.
+     *
+     * @param out a reference to the value that will be populated by the
+     *            highest priority element
+     * @return true, if the operation succeeded (queue wasn't empty),
+     * @return false otherwise
+     */
+    constexpr bool PeekAndPop(T& out) noexcept
+    {
+        if (IsEmpty()) {
+            return false;
+        }
+
+        out = std::move(m_heap[0]);
+        Erase(0);
+        return true;
+    }
+
+    /**
+     * @brief Replaces the contents of the queue with a range of elements,
+     *        in linear time
+     *
+     * Elements that do not fit are dropped. The range must not point into
+     * this queue.
+     *
+     * @tparam It forward iterator type, must dereference to a type that T can be
+     *            constructed from
+     * @param first an iterator to the beginning of the range
+     * @param last an iterator to the end of the range
+     * @return the number of elements queued
+     */
+    template <typename It>
+    constexpr size_t Heapify(It first, It last)
+    {
+        m_heap.Clear();
+        const size_t count = m_heap.AppendRange(first, last);
+
+        for (size_t position = count / arity + 1; position-- > 0;) {
+            SiftDown(position);
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Clears the queue
+     */
+    constexpr void Clear() noexcept
+    {
+        m_heap.Clear();
+    }
+
+    ///@}
+
+    /**
+     * @name Handle operations
+     */
+    ///@{
+
+    /**
+     * @brief Checks, if a handle refers to a queued element
+     *
+     * @param handle the handle to check
+     * @return true if it does,
+     * @return false otherwise
+     */
+    [[nodiscard]] constexpr bool Contains(Handle handle) const noexcept
+    {
+        return handle.slot < maxSize && m_positions[handle.slot] < m_heap.GetSize();
+    }
+
+    /**
+     * @brief Gets the element a handle refers to
+     *
+     * The element is read-only, use Update() to change it.
+     *
+     * @param handle the handle of the element
+     * @return pointer to the element, or nullptr if the handle is invalid
+     */
+    [[nodiscard]] constexpr const T* Get(Handle handle) const noexcept
+    {
+        return Contains(handle) ? &m_heap[m_positions[handle.slot]] : nullptr;
+    }
+
+    /**
+     * @brief Replaces an element and moves it to its new place in the queue
+     *
+     * @tparam U type of the new value
+     * @param handle the handle of the element
+     * @param value the new value
+     * @return true, if the operation succeeded (handle was valid),
+     * @return false otherwise
+     */
+    template <typename U>
+    constexpr bool Update(Handle handle, U&& value) noexcept
+    {
+        if (!Contains(handle)) {
+            return false;
+        }
+
+        const size_t position = m_positions[handle.slot];
+        m_heap[position] = std::forward<U>(value);
+        Restore(position);
+        return true;
+    }
+
+    /**
+     * @brief Replaces an element with one of the same or higher priority,
+     *        which only moves it towards the top
+     *
+     * @tparam U type of the new value
+     * @param handle the handle of the element
+     * @param value the new value, must not compare less than the current one
+     * @return true, if the operation succeeded (handle was valid and
+     *         the priority didn't drop),
+     * @return false otherwise
+     */
+    template <typename U>
+    constexpr bool DecreaseKey(Handle handle, U&& value) noexcept
+    {
+        if (!Contains(handle)) {
+            return false;
+        }
+
+        const size_t position = m_positions[handle.slot];
+        if (m_compare(value, m_heap[position])) {
+            return false;
+        }
+
+        m_heap[position] = std::forward<U>(value);
+        SiftUp(position);
+        return true;
+    }
+
+    /**
+     * @brief Removes an element from the queue
+     *
+     * @param handle the handle of the element
+     * @return true, if the operation succeeded (handle was valid),
+     * @return false otherwise
+     */
+    constexpr bool Remove(Handle handle) noexcept
+    {
+        if (!Contains(handle)) {
+            return false;
+        }
+
+        Erase(m_positions[handle.slot]);
+        return true;
+    }
+
+    ///@}
+
+private:
+    /**
+     * @brief The elements, in heap order
+     */
+    StaticVector<T, maxSize> m_heap;
+
+    /**
+     * @brief The slot of the element at every heap position, positions
+     *        past the end hold the free slots
+     */
+    std::array<IndexType, maxSize> m_slots {};
+
+    /**
+     * @brief The heap position of every slot, the inverse of m_slots
+     */
+    std::array<IndexType, maxSize> m_positions {};
+
+    [[no_unique_address]] Compare m_compare;
+
+    /**
+     * @brief Moves the element at one heap position to another one,
+     *        along with its slot
+     */
+    constexpr void MoveElement(size_t from, size_t to) noexcept
+    {
+        m_heap[to] = std::move(m_heap[from]);
+        m_slots[to] = m_slots[from];
+        m_positions[m_slots[to]] = static_cast<IndexType>(to);
+    }
+
+    /**
+     * @brief Puts an element taken out of the heap back at a position
+     */
+    constexpr void PlaceElement(size_t position, T&& value, IndexType slot) noexcept
+    {
+        m_heap[position] = std::move(value);
+        m_slots[position] = slot;
+        m_positions[slot] = static_cast<IndexType>(position);
+    }
+
+    /**
+     * @brief Moves an element towards the top, as long as it has a higher
+     *        priority than its parent
+     */
+    constexpr void SiftUp(size_t position) noexcept
+    {
+        T value = std::move(m_heap[position]);
+        const IndexType slot = m_slots[position];
+
+        while (position > 0) {
+            const size_t parent = (position - 1) / arity;
+            if (!m_compare(m_heap[parent], value)) {
+                break;
+            }
+
+            MoveElement(parent, position);
+            position = parent;
+        }
+
+        PlaceElement(position, std::move(value), slot);
+    }
+
+    /**
+     * @brief Moves an element towards the bottom, as long as one of its
+     *        children has a higher priority
+     */
+    constexpr void SiftDown(size_t position) noexcept
+    {
+        const size_t count = m_heap.GetSize();
+        if (position >= count) {
+            return;
+        }
+
+        T value = std::move(m_heap[position]);
+        const IndexType slot = m_slots[position];
+
+        for (size_t first = position * arity + 1; first < count; first = position * arity + 1) {
+            const size_t last = std::min(first + arity, count);
+
+            size_t best = first;
+            for (size_t child = first + 1; child < last; ++child) {
+                best = m_compare(m_heap[best], m_heap[child]) ? child : best;
+            }
+
+            if (!m_compare(value, m_heap[best])) {
+                break;
+            }
+
+            MoveElement(best, position);
+            position = best;
+        }
+
+        PlaceElement(position, std::move(value), slot);
+    }
+
+    /**
+     * @brief Moves a changed element up or down, whichever it needs
+     */
+    constexpr void Restore(size_t position) noexcept
+    {
+        if (position > 0 && m_compare(m_heap[(position - 1) / arity], m_heap[position])) {
+            SiftUp(position);
+        } else {
+            SiftDown(position);
+        }
+    }
+
+    /**
+     * @brief Removes the element at a heap position, filling the gap
+     *        with the last element and freeing the slot
+     */
+    constexpr void Erase(size_t position) noexcept
+    {
+        const size_t last = m_heap.GetSize() - 1;
+        const IndexType slot = m_slots[position];
+
+        if (position != last) {
+            MoveElement(last, position);
+        }
+
+        m_heap.RemoveIndex(last);
+        m_slots[last] = slot;
+        m_positions[slot] = static_cast<IndexType>(last);
+
+        if (position != last) {
+            Restore(position);
+        }
+    }
+};
+
+};
@@ -0,0 +1,425 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "cacheline.hpp"
+#include "sizetype.hpp"
+#include "staticvector.hpp"
+
+namespace lg {
+
+/**
+ * @brief A dynamically sized table using only statically allocated memory,
+ *        storing each field in its own array (structure of arrays).
+ *
+ * Every row consists of one value of each of the field types. Where
+ * a StaticVector of structs interleaves the fields in memory,
+ * StaticSoAVector keeps all values of a field contiguous, so a loop
+ * touching only one or two fields reads no unrelated data and can be
+ * vectorized by the compiler.
+ *
+ * Each field array starts at a cache line boundary and is left uninitialized
+ * beyond the current size, which is stored once for all of them. The semantics
+ * of Append(), RemoveIndex(), SwapRemove() and Clear() are those of
+ * StaticVector, applied to all the fields at once.
+ *
+ * StaticSoAVector will never throw any exceptions.
+ *
+ * @tparam maxSize capacity, in rows
+ * @tparam Fields the types of the fields
+ */
+template <std::size_t maxSize, typename... Fields>
+class StaticSoAVector {
+public:
+    static_assert(maxSize > 0, "vector capacity must be greater than 0");
+    static_assert(sizeof...(Fields) > 0, "vector must have at least one field");
+
+    /**
+     * @brief The type of the field at the given index
+     *
+     * @tparam fieldIndex index of the field
+     */
+    template <std::size_t fieldIndex>
+    using FieldType = std::tuple_element_t<fieldIndex, std::tuple<Fields...>>;
+
+    /**
+     * @name Constructors and destructors
+     */
+    ///@{
+
+    /**
+     * @brief Default constructor, initializes an empty vector
+     */
+    constexpr StaticSoAVector() noexcept = default;
+
+    /**
+     * @brief Destructor, destroys all the rows
+     */
+    constexpr ~StaticSoAVector()
+    {
+        Clear();
+    }
+
+    /**
+     * @brief Trivial destructor for trivially destructible field types
+     */
+    constexpr ~StaticSoAVector()
+        requires(std::is_trivially_destructible<Fields>::value && ...)
+    = default;
+
+    /**
+     * @brief Copy constructor, copies contents of another vector
+     *
+     * @param other vector to copy contents from
+     */
+    constexpr StaticSoAVector(const StaticSoAVector& other) noexcept(
+        (std::is_nothrow_copy_constructible<Fields>::value && ...))
+    {
+        ConstructFrom(other);
+    }
+
+    /**
+     * @brief Move constructor, moves contents of another vector
+     *
+     * @param other vector to move contents from, it is left empty
+     */
+    constexpr StaticSoAVector(StaticSoAVector&& other) noexcept(
+        (std::is_nothrow_move_constructible<Fields>::value && ...))
+    {
+        MoveFrom(other);
+    }
+
+    /**
+     * @brief Assignment operator, copies contents of another vector
+     *
+     * @param other the instance of the second vector
+     * @return reference to self
+     */
+    constexpr StaticSoAVector& operator=(const StaticSoAVector& other) noexcept(
+        (std::is_nothrow_copy_constructible<Fields>::value && ...))
+    {
+        if (this != &other) {
+            Clear();
+            ConstructFrom(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator, moves contents of another vector
+     *
+     * @param other the instance of the second vector, it is left empty
+     * @return reference to self
+     */
+    constexpr StaticSoAVector& operator=(StaticSoAVector&& other) noexcept(
+        (std::is_nothrow_move_constructible<Fields>::value && ...))
+    {
+        if (this != &other) {
+            Clear();
+            MoveFrom(other);
+        }
+
+        return *this;
+    }
+
+    ///@}
+
+    /**
+     * @name Size getters
+     */
+    ///@{
+
+    /**
+     * @brief Gets the vector capacity, in number of rows
+     *
+     * @return capacity in number of rows
+     */
+    [[nodiscard]] constexpr size_t GetCapacity() const noexcept
+    {
+        return maxSize;
+    }
+
+    /**
+     * @brief Gets the count of rows currently stored in the vector
+     *
+     * @return rows count
+     */
+    [[nodiscard]] constexpr size_t GetSize() const noexcept
+    {
+        return m_currentSize;
+    }
+
+    /**
+     * @brief Checks, if the vector is currently empty
+     *
+     * @return true if it is empty,
+     * @return false otherwise
+     */
+    [[nodiscard]] constexpr bool IsEmpty() const noexcept
+    {
+        return GetSize() == 0;
+    }
+
+    ///@}
+
+    /**
+     * @name Element access
+     */
+    ///@{
+
+    /**
+     * @brief Gets all the values of a field
+     *
+     * @tparam fieldIndex index of the field
+     * @return span over the field values, one per row
+     */
+    template <std::size_t fieldIndex>
+    [[nodiscard]] constexpr std::span<FieldType<fieldIndex>> GetField() noexcept
+    {
+        return { std::get<fieldIndex>(m_columns).elements, m_currentSize };
+    }
+
+    /**
+     * @brief Gets all the values of a field
+     *
+     * @tparam fieldIndex index of the field
+     * @return span over the const field values, one per row
+     */
+    template <std::size_t fieldIndex>
+    [[nodiscard]] constexpr std::span<const FieldType<fieldIndex>> GetField() const noexcept
+    {
+        return { std::get<fieldIndex>(m_columns).elements, m_currentSize };
+    }
+
+    /**
+     * @brief Access n-th row of the vector.
+     *
+     * In DEBUG mode additional bound checks are performed.
+     *
+     * @param n which row to access, indexing starts at 0
+     * @return tuple of references to the field values
+     */
+    [[nodiscard]] constexpr std::tuple<Fields&...> GetRow(size_t n) noexcept
+    {
+#ifdef NDEBUG
+        if (n >= m_currentSize) {
+            std::abort();
+        }
+#endif
+        return std::apply(
+            [n](auto&... columns) { return std::tuple<Fields&...>(columns.elements[n]...); },
+            m_columns);
+    }
+
+    /**
+     * @brief Access n-th row of the vector.
+     *
+     * In DEBUG mode additional bound checks are performed.
+     *
+     * @param n which row to access, indexing starts at 0
+     * @return tuple of const references to the field values
+     */
+    [[nodiscard]] constexpr std::tuple<const Fields&...> GetRow(size_t n) const noexcept
+    {
+#ifdef NDEBUG
+        if (n >= m_currentSize) {
+            std::abort();
+        }
+#endif
+        return std::apply(
+            [n](const auto&... columns) {
+                return std::tuple<const Fields&...>(columns.elements[n]...);
+            },
+            m_columns);
+    }
+
+    ///@}
+
+    /**
+     * @name Operations
+     */
+    ///@{
+
+    /**
+     * @brief Appends a row at the end of the vector
+     *
+     * @tparam Args types of the values, each field must be constructible
+     *              from the corresponding one
+     * @param values the field values of the new row
+     * @return true, if the operation succeeded (vector wasn't full),
+     * @return false otherwise
+     */
+    template <typename... Args>
+        requires(sizeof...(Args) == sizeof...(Fields))
+    constexpr bool Append(Args&&... values) noexcept
+    {
+        if (m_currentSize == maxSize)
+            return false;
+
+        std::apply(
+            [&](auto&... columns) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                (std::construct_at(columns.elements + m_currentSize, std::forward<Args>(values)), ...);
+            },
+            m_columns);
+
+        ++m_currentSize;
+        return true;
+    }
+
+    /**
+     * @brief Clears the vector
+     */
+    constexpr void Clear() noexcept
+    {
+        std::apply(
+            [this](auto&... columns) { (columns.Destroy(0, m_currentSize), ...); }, m_columns);
+        m_currentSize = 0;
+    }
+
+    /**
+     * @brief Removes a row specified by its index
+     *
+     * @param index index of the row to be removed
+     * @return true, if the operation succeeded (index was in a valid range),
+     * @return false otherwise
+     */
+    constexpr bool RemoveIndex(size_t index)
+    {
+        if (index >= m_currentSize)
+            return false;
+
+        std::apply(
+            [this, index](auto&... columns) { (columns.Erase(m_currentSize, index), ...); },
+            m_columns);
+
+        --m_currentSize;
+        return true;
+    }
+
+    /**
+     * @brief Removes a row specified by its index in constant time,
+     *        moving the last row into its place
+     *
+     * The order of the rows is not preserved.
+     *
+     * @param index index of the row to be removed
+     * @return true, if the operation succeeded (index was in a valid range),
+     * @return false otherwise
+     */
+    constexpr bool SwapRemove(size_t index)
+    {
+        if (index >= m_currentSize)
+            return false;
+
+        std::apply(
+            [this, index](auto&... columns) { (columns.SwapRemove(m_currentSize, index), ...); },
+            m_columns);
+
+        --m_currentSize;
+        return true;
+    }
+
+    ///@}
+
+private:
+    /**
+     * @brief The smallest unsigned type able to hold the vector size
+     */
+    using SizeType = MinimalSizeType<maxSize>;
+
+    /**
+     * @brief Uninitialized storage of a single field, aligned at least
+     *        to a cache line
+     *
+     * It borrows the element operations of StaticVector, the length is
+     * passed in from the vector.
+     */
+    template <typename F>
+    struct alignas(std::max(alignof(F), DEFAULT_CACHE_LINE_SIZE)) Column
+        : private StaticVectorBase<F> {
+        using Base = StaticVectorBase<F>;
+
+        union {
+            F elements[maxSize]; // NOLINT(*-avoid-c-arrays)
+        };
+
+        constexpr Column() noexcept { }
+
+        constexpr ~Column() { }
+
+        constexpr ~Column()
+            requires std::is_trivially_destructible<F>::value
+        = default;
+
+        constexpr void Construct(const Column& other, size_t count) noexcept(
+            std::is_nothrow_copy_constructible<F>::value)
+        {
+            Base::ConstructElements(elements, other.elements, count);
+        }
+
+        constexpr void Move(Column& other, size_t count) noexcept(
+            std::is_nothrow_move_constructible<F>::value)
+        {
+            Base::MoveElements(elements, other.elements, count);
+        }
+
+        constexpr void Destroy(size_t first, size_t last) noexcept
+        {
+            Base::DestroyElements(elements, first, last);
+        }
+
+        constexpr void Erase(size_t size, size_t index)
+        {
+            Base::EraseElements(elements, size, index, index + 1);
+        }
+
+        constexpr void SwapRemove(size_t size, size_t index)
+        {
+            Base::SwapRemoveElement(elements, size, index);
+        }
+    };
+
+    std::tuple<Column<Fields>...> m_columns;
+    SizeType m_currentSize { 0 };
+
+    constexpr void ConstructFrom(const StaticSoAVector& other) noexcept(
+        (std::is_nothrow_copy_constructible<Fields>::value && ...))
+    {
+        ForEachColumn(other, [&](auto& column, const auto& source) {
+            column.Construct(source, other.m_currentSize);
+        });
+        m_currentSize = other.m_currentSize;
+    }
+
+    constexpr void MoveFrom(StaticSoAVector& other) noexcept(
+        (std::is_nothrow_move_constructible<Fields>::value && ...))
+    {
+        ForEachColumn(other, [&](auto& column, auto& source) {
+            column.Move(source, other.m_currentSize);
+        });
+        m_currentSize = other.m_currentSize;
+        other.Clear();
+    }
+
+    /**
+     * @brief Calls a function with each column and the same column
+     *        of another vector
+     */
+    template <typename Other, typename Function>
+    constexpr void ForEachColumn(Other& other, Function&& function)
+    {
+        [&]<std::size_t... fieldIndices>(std::index_sequence<fieldIndices...>) {
+            (function(std::get<fieldIndices>(m_columns), std::get<fieldIndices>(other.m_columns)), ...);
+        }(std::index_sequence_for<Fields...> {});
+    }
+};
+
+};
@@ -1,11 +1,260 @@
 #pragma once
 #include <algorithm>
 #include <array>
-#include <cctype>
+#include <bit>
+#include <charconv>
+#include <compare>
+#include <concepts>
 #include <cstdlib>
+#include <cstring>
+
+#include "numberparse.hpp"
+#include "sizetype.hpp"
+#include "stringsearch.hpp"
 
 namespace lg {
 
+/**
+ * @brief The capacity-independent core of StaticString
+ *
+ * Every StaticString capacity is a distinct type, so any code written in
+ * the class template is instantiated once per capacity. The operations live
+ * here instead, as functions of a (pointer, length, capacity) triple, and
+ * StaticString only forwards to them with its own buffer. However many
+ * capacities a program uses, there is a single copy of each operation
+ * (or three for number formatting, one per unsigned type) and
+ * a single copy of the digit tables.
+ *
+ * The functions return the new string length and leave writing
+ * the terminator to the caller.
+ */
+class StaticStringBase {
+protected:
+    /**
+     * @brief Position or length returned by operations that failed
+     */
+    static constexpr size_t NPOS = SEARCH_NPOS;
+
+    /**
+     * @brief Appends characters, dropping those past the capacity
+     *
+     * @return the new length
+     */
+    static constexpr size_t AppendCharacters(char* data, size_t size, size_t capacity,
+        const char* source, size_t count) noexcept
+    {
+        const size_t copyCharacters = std::min(capacity - size, count);
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        std::copy(source, source + copyCharacters, data + size);
+        return size + copyCharacters;
+    }
+
+    /**
+     * @brief Appends a zero-terminated char array, dropping the characters
+     *        past the capacity
+     *
+     * @return the new length
+     */
+    static constexpr size_t AppendCString(
+        char* data, size_t size, size_t capacity, const char* source) noexcept
+    {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        for (; size < capacity && *source; ++size, ++source) {
+            data[size] = *source;
+        }
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        return size;
+    }
+
+    static bool Equals(const char* lhs, size_t lhsSize, const char* rhs, size_t rhsSize) noexcept
+    {
+        return lhsSize == rhsSize && std::memcmp(lhs, rhs, lhsSize) == 0;
+    }
+
+    static std::strong_ordering Compare(
+        const char* lhs, size_t lhsSize, const char* rhs, size_t rhsSize) noexcept
+    {
+        const int result = std::memcmp(lhs, rhs, std::min(lhsSize, rhsSize));
+
+        if (result != 0) {
+            return result <=> 0;
+        }
+
+        return lhsSize <=> rhsSize;
+    }
+
+    static bool HasPrefix(const char* data, size_t size, const char* prefix, size_t prefixSize) noexcept
+    {
+        return prefixSize <= size && std::memcmp(data, prefix, prefixSize) == 0;
+    }
+
+    static bool HasSuffix(const char* data, size_t size, const char* suffix, size_t suffixSize) noexcept
+    {
+        if (suffixSize > size) {
+            return false;
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return std::memcmp(data + size - suffixSize, suffix, suffixSize) == 0;
+    }
+
+    /**
+     * @brief Drops the first characters, shifting the rest to the front
+     *
+     * @return the new length, or NPOS if there are fewer characters
+     */
+    static size_t SkipChars(char* data, size_t size, size_t characters) noexcept
+    {
+        if (characters > size) {
+            return NPOS;
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        std::memmove(data, data + characters, size - characters);
+        return size - characters;
+    }
+
+    /**
+     * @brief Appends the digits of a number, with its sign and padding
+     *
+     * @return the new length, or NPOS if the number does not fit or
+     *         the base is invalid
+     */
+    template <typename UT>
+    static size_t AppendDigits(char* data, size_t size, size_t capacity, UT absolute,
+        bool negative, unsigned base, size_t width, char fill) noexcept
+    {
+        static constexpr unsigned MAX_BASE = 36;
+
+        if (base < 2 || base > MAX_BASE) {
+            return NPOS;
+        }
+
+        const size_t digits = CountDigits(absolute, base);
+        const size_t length = std::max(width, digits + (negative ? 1 : 0));
+
+        if (length > capacity - size) {
+            return NPOS;
+        }
+
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const size_t padding = length - digits - (negative ? 1 : 0);
+        char* position = data + size;
+
+        if (fill != '0') {
+            position = std::fill_n(position, padding, fill);
+        }
+
+        if (negative) {
+            *position++ = '-';
+        }
+
+        if (fill == '0') {
+            position = std::fill_n(position, padding, fill);
+        }
+
+        WriteDigits(position + digits, absolute, base);
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        return size + length;
+    }
+
+private:
+    // NOLINTBEGIN(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+    static constexpr char DIGITS[] = "0001020304050607080910111213141516171819"
+                                     "2021222324252627282930313233343536373839"
+                                     "4041424344454647484950515253545556575859"
+                                     "6061626364656667686970717273747576777879"
+                                     "8081828384858687888990919293949596979899";
+    static constexpr char ALPHANUMERICS[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+    // NOLINTEND(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+
+    template <typename UT>
+    static size_t CountDigits(UT value, unsigned base) noexcept
+    {
+        static constexpr unsigned int BASE = 10;
+        static constexpr unsigned int BASE_2 = 100;
+        static constexpr unsigned int BASE_3 = 1000;
+        static constexpr unsigned int BASE_4 = 10000;
+
+        if (base == BASE) {
+            size_t digits = 0;
+
+            while (true) {
+                if (value < BASE) {
+                    return digits + 1;
+                } else if (value < BASE_2) {
+                    return digits + 2;
+                } else if (value < BASE_3) {
+                    return digits + 3;
+                } else if (value < BASE_4) {
+                    return digits + 4;
+                }
+
+                digits += 4;
+                value /= BASE_4;
+            }
+        }
+
+        if (std::has_single_bit(base)) {
+            const auto bitsPerDigit = static_cast<size_t>(std::countr_zero(base));
+            const auto bits = static_cast<size_t>(std::bit_width(value));
+            return std::max<size_t>(1, (bits + bitsPerDigit - 1) / bitsPerDigit);
+        }
+
+        size_t digits = 1;
+        for (; value >= base; value /= base) {
+            ++digits;
+        }
+
+        return digits;
+    }
+
+    /**
+     * @brief Writes the digits of a value backwards, ending just before
+     *        the given pointer
+     */
+    template <typename UT>
+    static void WriteDigits(char* end, UT value, unsigned base) noexcept
+    {
+        static constexpr unsigned int BASE = 10;
+        static constexpr unsigned int BASE_2 = 100;
+
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if (base == BASE) {
+            while (value >= BASE_2) {
+                const auto part = static_cast<size_t>(value % BASE_2);
+                *--end = DIGITS[part * 2 + 1];
+                *--end = DIGITS[part * 2];
+
+                value /= BASE_2;
+            }
+
+            if (value >= BASE) {
+                *--end = DIGITS[value * 2 + 1];
+                *--end = DIGITS[value * 2];
+            } else {
+                *--end = DIGITS[value * 2 + 1];
+            }
+        } else if (std::has_single_bit(base)) {
+            const auto bitsPerDigit = static_cast<unsigned>(std::countr_zero(base));
+
+            do {
+                *--end = ALPHANUMERICS[value & (base - 1)];
+                value >>= bitsPerDigit;
+            } while (value != 0);
+        } else {
+            do {
+                *--end = ALPHANUMERICS[value % base];
+                value /= base;
+            } while (value != 0);
+        }
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+};
+
 /**
  * @brief A dynamically sized string class using only statically allocated memory.
  *
@@ -17,7 +266,7 @@ namespace lg {
  * @tparam maxSize String capacity, in characters
  */
 template <std::size_t maxSize>
-class StaticString {
+class StaticString : private StaticStringBase {
 public:
     static_assert(maxSize > 0, "string capacity must be greater than 0");
 
@@ -34,6 +283,11 @@ public:
      */
     using ConstIterator = const char*;
 
+    /**
+     * @brief Position returned by searches that found nothing
+     */
+    static constexpr size_t NPOS = StaticStringBase::NPOS;
+
     /**
      * @brief Converts an integral value to string.
      *
@@ -47,73 +301,8 @@ public:
     template <typename T>
     static StaticString Of(T value)
     {
-        // NOLINTBEGIN(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
-        static constexpr char DIGITS[] = "0001020304050607080910111213141516171819"
-                                         "2021222324252627282930313233343536373839"
-                                         "4041424344454647484950515253545556575859"
-                                         "6061626364656667686970717273747576777879"
-                                         "8081828384858687888990919293949596979899";
-        // NOLINTEND(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
-
-        using UT = std::make_unsigned_t<T>;
-
-        bool negative = value < 0;
-        UT absolute = static_cast<UT>(negative ? (-value) : value);
-
-        size_t outputLength = negative ? 1 : 0;
-        UT absoluteCopy = absolute;
-
-        static constexpr unsigned int BASE = 10;
-        static constexpr unsigned int BASE_2 = 100;
-        static constexpr unsigned int BASE_3 = 1000;
-        static constexpr unsigned int BASE_4 = 10000;
-
-        while (true) {
-            if (absoluteCopy < BASE) {
-                outputLength += 1;
-                break;
-            } else if (absoluteCopy < BASE_2) {
-                outputLength += 2;
-                break;
-            } else if (absoluteCopy < BASE_3) {
-                outputLength += 3;
-                break;
-            } else if (absoluteCopy < BASE_4) {
-                outputLength += 4;
-                break;
-            }
-
-            outputLength += 4;
-            absoluteCopy /= BASE_4;
-        }
-
         StaticString result;
-
-        if (outputLength <= maxSize) {
-            result.m_currentSize = outputLength;
-
-            size_t bufferPosition = outputLength - 1;
-
-            if (negative) {
-                result.m_buffer[0] = '-';
-            }
-
-            while (absolute >= BASE_2) {
-                UT part = absolute % BASE_2;
-                result.m_buffer[bufferPosition--] = DIGITS[part * 2 + 1];
-                result.m_buffer[bufferPosition--] = DIGITS[part * 2];
-
-                absolute /= BASE_2;
-            }
-
-            if (absolute >= BASE) {
-                result.m_buffer[bufferPosition--] = DIGITS[absolute * 2 + 1];
-                result.m_buffer[bufferPosition] = DIGITS[absolute * 2];
-            } else {
-                result.m_buffer[bufferPosition] = DIGITS[absolute * 2 + 1];
-            }
-        }
-
+        result.AppendNumber(value);
         return result;
     }
 
@@ -157,15 +346,17 @@ public:
     }
 
     /**
-     * @brief Move constructor, copies contents of another StaticString instance.
+     * @brief Move constructor, takes over contents of another StaticString
+     *        instance.
      *
-     * It performs exactly the same as a copy constructor.
+     * The other string is left empty.
      *
-     * @param other string to copy contents from
+     * @param other string to move contents from
      */
-    constexpr StaticString(StaticString&& other)
+    constexpr StaticString(StaticString&& other) noexcept
         : StaticString(other)
     {
+        other.SetSize(0);
     }
 
     /**
@@ -186,10 +377,7 @@ public:
      */
     constexpr StaticString(const char* buffer, size_t length) noexcept
     {
-        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        m_currentSize = std::min(maxSize, length);
-        std::copy(buffer, buffer + m_currentSize, m_buffer.begin());
-        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        SetSize(AppendCharacters(m_buffer.data(), 0, maxSize, buffer, length));
     }
     ///@}
 
@@ -208,9 +396,7 @@ public:
     template <std::size_t otherSize>
     constexpr StaticString& operator=(const StaticString<otherSize>& other) noexcept
     {
-        m_currentSize = std::min(maxSize, other.m_currentSize);
-        std::copy(other.m_buffer.begin(),
-            other.m_buffer.begin() + m_currentSize, m_buffer.begin());
+        SetSize(AppendCharacters(m_buffer.data(), 0, maxSize, other.m_buffer.data(), other.m_currentSize));
         return *this;
     }
 
@@ -222,9 +408,7 @@ public:
      */
     constexpr StaticString& operator=(const StaticString& other) noexcept
     {
-        std::copy(other.m_buffer.begin(),
-            other.m_buffer.begin() + other.m_currentSize, m_buffer.begin());
-        m_currentSize = other.m_currentSize;
+        SetSize(AppendCharacters(m_buffer.data(), 0, maxSize, other.m_buffer.data(), other.m_currentSize));
         return *this;
     }
 
@@ -236,28 +420,25 @@ public:
      */
     constexpr StaticString& operator=(const char* buffer) noexcept
     {
-        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        for (m_currentSize = 0; m_currentSize < maxSize; ++m_currentSize) {
-            m_buffer[m_currentSize] = buffer[m_currentSize];
-
-            if (!m_buffer[m_currentSize])
-                break;
-        }
+        SetSize(AppendCString(m_buffer.data(), 0, maxSize, buffer));
         return *this;
-        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     }
 
     /**
-     * @brief Move assignment operator, copies contents of another string
+     * @brief Move assignment operator, takes over contents of another string
      *
-     * It performs exactly the same as a normal copy assignment operator.
+     * The other string is left empty, unless it is this string.
      *
      * @param other the instance of the second string
      * @return reference to self
      */
-    constexpr StaticString& operator=(StaticString&& other)
+    constexpr StaticString& operator=(StaticString&& other) noexcept
     {
-        *this = other;
+        if (this != &other) {
+            *this = other;
+            other.SetSize(0);
+        }
+
         return *this;
     }
 
@@ -308,16 +489,7 @@ public:
     template <size_t otherSize>
     bool operator==(const StaticString<otherSize>& other) const noexcept
     {
-        if (m_currentSize != other.m_currentSize) {
-            return false;
-        }
-
-        for (size_t i = 0; i < m_currentSize; ++i) {
-            if (m_buffer[i] != other.m_buffer[i])
-                return false;
-        }
-
-        return true;
+        return Equals(m_buffer.data(), m_currentSize, other.m_buffer.data(), other.m_currentSize);
     }
 
     /**
@@ -334,6 +506,20 @@ public:
         return !(*this == other);
     }
 
+    /**
+     * @brief Compares two string instances lexicographically, by character
+     *        values taken as unsigned
+     *
+     * @tparam otherSize capacity of the second string
+     * @param other the second string to compare
+     * @return the ordering of this string relative to the second one
+     */
+    template <size_t otherSize>
+    std::strong_ordering operator<=>(const StaticString<otherSize>& other) const noexcept
+    {
+        return Compare(m_buffer.data(), m_currentSize, other.m_buffer.data(), other.m_currentSize);
+    }
+
     /**
      * @brief Appends (concatenates) a second string
      *
@@ -344,15 +530,7 @@ public:
     template <size_t otherSize>
     StaticString& operator+=(const StaticString<otherSize>& other) noexcept
     {
-        size_t maxCharacters = maxSize - m_currentSize;
-        size_t copyCharacters = std::min(maxCharacters, other.m_currentSize);
-
-        std::copy(other.m_buffer.begin(),
-            other.m_buffer.begin() + copyCharacters,
-            m_buffer.begin() + m_currentSize);
-
-        m_currentSize += copyCharacters;
-        return *this;
+        return Append(other.m_buffer.data(), other.m_currentSize);
     }
 
     /**
@@ -363,14 +541,7 @@ public:
      */
     StaticString& operator+=(const char* buffer) noexcept
     {
-        size_t maxCharacters = maxSize - m_currentSize;
-        for (size_t i = 0; i < maxCharacters; ++i, ++m_currentSize) {
-            // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-            if (!buffer[i])
-                break;
-            m_buffer[m_currentSize] = buffer[i];
-            // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        }
+        SetSize(AppendCString(m_buffer.data(), m_currentSize, maxSize, buffer));
         return *this;
     }
 
@@ -383,7 +554,8 @@ public:
     StaticString& operator+=(char c) noexcept
     {
         if (m_currentSize < maxSize) {
-            m_buffer[m_currentSize++] = c;
+            m_buffer[m_currentSize] = c;
+            SetSize(m_currentSize + 1);
         }
 
         return *this;
@@ -391,6 +563,133 @@ public:
 
     ///@}
 
+    /**
+     * @name Formatting
+     */
+    ///@{
+
+    /**
+     * @brief Appends characters from a char array
+     *
+     * Characters that do not fit are dropped.
+     *
+     * @param data pointer to char array
+     * @param length number of characters
+     * @return reference to self
+     */
+    StaticString& Append(const char* data, size_t length) noexcept
+    {
+        SetSize(AppendCharacters(m_buffer.data(), m_currentSize, maxSize, data, length));
+        return *this;
+    }
+
+    /**
+     * @brief Appends an integral value, written directly into the string
+     *
+     * If the value does not fit, the string is left unchanged.
+     *
+     * @tparam T integer type, other than bool
+     * @param value value to append
+     * @param base numeric base, from 2 to 36
+     * @param width minimum number of characters, shorter numbers are padded
+     *              on the left
+     * @param fill padding character, with '0' the padding goes between
+     *             the sign and the digits
+     * @return true, if the operation succeeded,
+     * @return false otherwise
+     */
+    template <std::integral T>
+        requires(!std::is_same<T, bool>::value)
+    bool AppendNumber(T value, unsigned base = 10, size_t width = 0, char fill = ' ') noexcept
+    {
+        // Narrow types are widened, they would be promoted by every operation
+        using UT = std::common_type_t<std::make_unsigned_t<T>, unsigned>;
+
+        bool negative = false;
+        if constexpr (std::is_signed<T>::value) {
+            negative = value < 0;
+        }
+
+        const UT absolute = negative ? static_cast<UT>(UT {} - static_cast<UT>(value))
+                                     : static_cast<UT>(value);
+        const size_t size = AppendDigits(m_buffer.data(), m_currentSize, maxSize,
+            absolute, negative, base, width, fill);
+
+        if (size == NPOS) {
+            return false;
+        }
+
+        SetSize(size);
+        return true;
+    }
+
+    /**
+     * @brief Appends the hexadecimal representation of an integral value,
+     *        written directly into the string
+     *
+     * Signed values are written as their two's complement bit pattern.
+     * If the value does not fit, the string is left unchanged.
+     *
+     * @tparam T integer type, other than bool
+     * @param value value to append
+     * @param width minimum number of digits, shorter numbers are padded
+     *              with zeros
+     * @return true, if the operation succeeded,
+     * @return false otherwise
+     */
+    template <std::integral T>
+        requires(!std::is_same<T, bool>::value)
+    bool AppendHex(T value, size_t width = 0) noexcept
+    {
+        static constexpr unsigned HEX_BASE = 16;
+        return AppendNumber(static_cast<std::make_unsigned_t<T>>(value), HEX_BASE, width, '0');
+    }
+
+    /**
+     * @brief Appends the shortest representation of a floating-point value
+     *        that parses back to the same value, written directly
+     *        into the string
+     *
+     * If the value does not fit, the string is left unchanged.
+     *
+     * @tparam T floating-point type
+     * @param value value to append
+     * @return true, if the operation succeeded,
+     * @return false otherwise
+     */
+    template <std::floating_point T>
+    bool AppendFloat(T value) noexcept
+    {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return AppendChars(std::to_chars(
+            m_buffer.data() + m_currentSize, m_buffer.data() + maxSize, value));
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    /**
+     * @brief Appends a floating-point value with the given format and
+     *        precision, written directly into the string
+     *
+     * If the value does not fit, the string is left unchanged.
+     *
+     * @tparam T floating-point type
+     * @param value value to append
+     * @param format fixed, scientific or general notation
+     * @param precision number of digits, as in printf()
+     * @return true, if the operation succeeded,
+     * @return false otherwise
+     */
+    template <std::floating_point T>
+    bool AppendFloat(T value, std::chars_format format, int precision) noexcept
+    {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return AppendChars(std::to_chars(m_buffer.data() + m_currentSize,
+            m_buffer.data() + maxSize, value, format, precision));
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    ///@}
+
     /**
      * @name Size getters
      */
@@ -411,7 +710,7 @@ public:
      *
      * @return String length, in bytes/characters
      */
-    [[nodiscard]] size_t GetSize() const noexcept
+    [[nodiscard]] constexpr size_t GetSize() const noexcept
     {
         return m_currentSize;
     }
@@ -421,7 +720,7 @@ public:
      *
      * @return String length, in bytes/characters
      */
-    [[nodiscard]] size_t GetLength() const noexcept
+    [[nodiscard]] constexpr size_t GetLength() const noexcept
     {
         return m_currentSize;
     }
@@ -432,7 +731,7 @@ public:
      * @return true if it is empty,
      * @return false otherwise
      */
-    [[nodiscard]] bool IsEmpty() const noexcept
+    [[nodiscard]] constexpr bool IsEmpty() const noexcept
     {
         return m_currentSize == 0;
     }
@@ -449,39 +748,63 @@ public:
      *
      * @return Pointer to a zero-terminated char array
      */
-    [[nodiscard]] const char* ToCStr() const noexcept
+    [[nodiscard]] constexpr const char* ToCStr() const noexcept
     {
-        m_buffer[m_currentSize] = '\0';
         return m_buffer.data();
     }
 
     /**
      * @brief Converts string to integral type
-     * 
+     *
      * @tparam T type of integral type
      * @return conversion result or 0, if conversion failed
      */
-    template <typename T>
+    template <std::integral T>
     [[nodiscard]] T ToInteger() const noexcept
     {
-        T value {};
-        bool negative = false;
-        bool first = true;
-
-        for (auto c : *this) {
-            if (std::isdigit(c)) {
-                value *= 10;
-                value += c - '0';
-            } else if (first && c == '-') {
-                negative = true;
-            } else {
-                return T {};
-            }
+        return Parse<T>().value;
+    }
 
-            first = false;
-        }
+    /**
+     * @brief Parses the whole string as an integer
+     *
+     * A leading '-' is accepted for signed types, no prefixes such as "0x"
+     * are. Decimal numbers are converted 8 digits at a time.
+     *
+     * @tparam T type of integral type
+     * @param base numeric base, from 2 to 36
+     * @return the parsed number and the error code
+     */
+    template <std::integral T>
+    [[nodiscard]] ParseResult<T> Parse(unsigned base = 10) const noexcept
+    {
+        return ParseInteger<T>(m_buffer.data(), m_currentSize, base);
+    }
+
+    /**
+     * @brief Converts string to floating-point type
+     *
+     * @tparam T floating-point type
+     * @return conversion result or 0, if conversion failed
+     */
+    template <std::floating_point T = double>
+    [[nodiscard]] T ToFloat() const noexcept
+    {
+        return ParseFloat<T>().value;
+    }
 
-        return value * (negative ? -1 : 1);
+    /**
+     * @brief Parses the whole string as a floating-point number
+     *
+     * @tparam T floating-point type
+     * @param format accepted notations, as in std::from_chars()
+     * @return the parsed number and the error code
+     */
+    template <std::floating_point T = double>
+    [[nodiscard]] ParseResult<T> ParseFloat(
+        std::chars_format format = std::chars_format::general) const noexcept
+    {
+        return lg::ParseFloat<T>(m_buffer.data(), m_currentSize, format);
     }
 
     /**
@@ -506,7 +829,7 @@ public:
      */
     void Clear() noexcept
     {
-        m_currentSize = 0;
+        SetSize(0);
     }
 
     /**
@@ -520,16 +843,7 @@ public:
     template <size_t otherSize>
     bool StartsWith(const StaticString<otherSize>& other) const noexcept
     {
-        if (other.m_currentSize > m_currentSize) {
-            return false;
-        }
-
-        for (size_t i = 0; i < other.m_currentSize; ++i) {
-            if (m_buffer[i] != other.m_buffer[i])
-                return false;
-        }
-
-        return true;
+        return HasPrefix(m_buffer.data(), m_currentSize, other.m_buffer.data(), other.m_currentSize);
     }
 
     /**
@@ -543,39 +857,124 @@ public:
     template <size_t otherSize>
     bool EndsWith(const StaticString<otherSize>& other) const noexcept
     {
-        if (other.m_currentSize > m_currentSize) {
-            return false;
-        }
+        return HasSuffix(m_buffer.data(), m_currentSize, other.m_buffer.data(), other.m_currentSize);
+    }
 
-        for (int i = m_currentSize - 1, j = other.m_currentSize - 1; j >= 0; --i, --j) {
-            if (m_buffer[i] != other.m_buffer[j])
-                return false;
-        }
+    /**
+     * @brief Finds the first occurrence of a character
+     *
+     * @param c character to search for
+     * @param position index to start the search at
+     * @return index of the occurrence, or NPOS if there is none
+     */
+    [[nodiscard]] size_t Find(char c, size_t position = 0) const noexcept
+    {
+        return FindCharFrom(m_buffer.data(), m_currentSize, c, position);
+    }
 
-        return true;
+    /**
+     * @brief Finds the first occurrence of a substring
+     *
+     * @tparam otherSize capacity of the substring
+     * @param needle substring to search for
+     * @param position index to start the search at
+     * @return index of the occurrence, or NPOS if there is none;
+     *         an empty substring is found at the starting index
+     */
+    template <size_t otherSize>
+    [[nodiscard]] size_t Find(const StaticString<otherSize>& needle, size_t position = 0) const noexcept
+    {
+        return FindSubstringFrom(m_buffer.data(), m_currentSize,
+            needle.m_buffer.data(), needle.m_currentSize, position);
+    }
+
+    /**
+     * @brief Finds the first character that is any of the provided ones
+     *
+     * @tparam otherSize capacity of the set string
+     * @param set characters to search for
+     * @param position index to start the search at
+     * @return index of the occurrence, or NPOS if there is none
+     */
+    template <size_t otherSize>
+    [[nodiscard]] size_t FindFirstOf(const StaticString<otherSize>& set, size_t position = 0) const noexcept
+    {
+        return FindFirstOfFrom(m_buffer.data(), m_currentSize,
+            set.m_buffer.data(), set.m_currentSize, position);
+    }
+
+    /**
+     * @brief Checks, if the string contains a character
+     *
+     * @param c character to search for
+     * @return true, if the character is present,
+     * @return false otherwise
+     */
+    [[nodiscard]] bool Contains(char c) const noexcept
+    {
+        return Find(c) != NPOS;
+    }
+
+    /**
+     * @brief Checks, if the string contains a substring
+     *
+     * @tparam otherSize capacity of the substring
+     * @param needle substring to search for
+     * @return true, if the substring is present,
+     * @return false otherwise
+     */
+    template <size_t otherSize>
+    [[nodiscard]] bool Contains(const StaticString<otherSize>& needle) const noexcept
+    {
+        return Find(needle) != NPOS;
+    }
+
+    /**
+     * @brief Counts the occurrences of a character
+     *
+     * @param c character to count
+     * @return number of occurrences
+     */
+    [[nodiscard]] size_t Count(char c) const noexcept
+    {
+        return CountChar(m_buffer.data(), m_currentSize, c);
+    }
+
+    /**
+     * @brief Counts the non-overlapping occurrences of a substring
+     *
+     * @tparam otherSize capacity of the substring
+     * @param needle substring to count, an empty one is never counted
+     * @return number of occurrences
+     */
+    template <size_t otherSize>
+    [[nodiscard]] size_t Count(const StaticString<otherSize>& needle) const noexcept
+    {
+        return CountSubstrings(m_buffer.data(), m_currentSize,
+            needle.m_buffer.data(), needle.m_currentSize);
     }
 
     /**
      * @brief Skips n first characters
-     * 
+     *
+     * The remaining characters are shifted to the front, with a single
+     * memmove() call. To consume a string piece by piece, slice
+     * a StaticStringView of it instead.
+     *
      * @param characters number of characters to skip
      * @return true, if the operation succeeded,
      * @return false otherwise
      */
     bool Skip(std::size_t characters) noexcept
     {
-        if (characters > m_currentSize) {
+        const size_t size = SkipChars(m_buffer.data(), m_currentSize, characters);
+
+        if (size == NPOS) {
             return false;
-        } else if (characters == m_currentSize) {
-            Clear();
-            return true;
-        } else {
-            for (size_t i = 0; i <= m_currentSize - characters; ++i) {
-                m_buffer[i] = m_buffer[i + characters];
-            }
-            m_currentSize -= characters;
-            return true;
         }
+
+        SetSize(size);
+        return true;
     }
 
     /**
@@ -593,7 +992,7 @@ public:
      *
      * @return iterator object
      */
-    [[nodiscard]] ConstIterator begin() const noexcept
+    [[nodiscard]] constexpr ConstIterator begin() const noexcept
     {
         return m_buffer.begin();
     }
@@ -613,7 +1012,7 @@ public:
      *
      * @return iterator object
      */
-    [[nodiscard]] ConstIterator end() const noexcept
+    [[nodiscard]] constexpr ConstIterator end() const noexcept
     {
         return m_buffer.begin() + m_currentSize;
     }
@@ -632,15 +1031,44 @@ public:
             return false;
         }
 
-        m_currentSize = length;
+        SetSize(length);
         return true;
     }
 
     ///@}
 
 private:
-    size_t m_currentSize { 0 };
-    mutable std::array<char, maxSize + 1> m_buffer {};
+    /**
+     * @brief The smallest unsigned type able to hold the string length
+     */
+    using SizeType = MinimalSizeType<maxSize>;
+
+    /**
+     * @brief Takes over the characters written by std::to_chars()
+     */
+    bool AppendChars(std::to_chars_result result) noexcept
+    {
+        if (result.ec != std::errc {}) {
+            return false;
+        }
+
+        SetSize(static_cast<size_t>(result.ptr - m_buffer.data()));
+        return true;
+    }
+
+    /**
+     * @brief Sets the string length and writes the terminator after it
+     *
+     * @param size new length, at most maxSize
+     */
+    constexpr void SetSize(size_t size) noexcept
+    {
+        m_currentSize = static_cast<SizeType>(size);
+        m_buffer[size] = '\0';
+    }
+
+    std::array<char, maxSize + 1> m_buffer {};
+    SizeType m_currentSize { 0 };
 };
 
 // NOLINTBEGIN(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
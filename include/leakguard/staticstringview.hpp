@@ -0,0 +1,629 @@
+#pragma once
+#include <algorithm>
+#include <charconv>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdlib>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#include "numberparse.hpp"
+#include "staticstring.hpp"
+#include "stringsearch.hpp"
+
+namespace lg {
+
+class StaticStringTokens;
+
+/**
+ * @brief A non-owning, read-only view of a sequence of characters.
+ *
+ * A view is just a pointer and a length, so taking a substring or skipping
+ * a prefix only adjusts those two and never copies characters. That makes
+ * it the tool of choice for parsing: consume a StaticString by slicing
+ * views of it, instead of repeatedly shifting its contents.
+ *
+ * Any StaticString, zero-terminated C-style array or std::string_view is
+ * implicitly converted to a view. The viewed characters must outlive
+ * the view, so a view of a temporary string must not be kept.
+ *
+ * StaticStringView will never throw any exceptions.
+ */
+class StaticStringView {
+public:
+    /**
+     * @brief Bidirectional, random access const iterator to characters
+     */
+    using ConstIterator = const char*;
+
+    /**
+     * @brief Position returned by searches that found nothing
+     */
+    static constexpr size_t NPOS = SEARCH_NPOS;
+
+    /**
+     * @name Constructors
+     */
+    ///@{
+
+    /**
+     * @brief Default constructor, creates an empty view
+     */
+    constexpr StaticStringView() noexcept = default;
+
+    /**
+     * @brief Constructs a view of a char array and its length
+     *
+     * @param data pointer to char array
+     * @param length number of characters
+     */
+    constexpr StaticStringView(const char* data, size_t length) noexcept
+        : m_data(data)
+        , m_length(length)
+    {
+    }
+
+    /**
+     * @brief Constructs a view of a zero-terminated C-style char array
+     *
+     * @param buffer pointer to a zero-terminated char array
+     */
+    constexpr StaticStringView(const char* buffer) noexcept
+        : StaticStringView(std::string_view(buffer))
+    {
+    }
+
+    /**
+     * @brief Constructs a view of the contents of a StaticString
+     *
+     * @tparam maxSize capacity of the string
+     * @param string the viewed string
+     */
+    template <std::size_t maxSize>
+    constexpr StaticStringView(const StaticString<maxSize>& string) noexcept
+        : m_data(string.begin())
+        , m_length(string.GetSize())
+    {
+    }
+
+    /**
+     * @brief Constructs a view of the characters viewed by std::string_view
+     *
+     * @param view the standard view
+     */
+    constexpr StaticStringView(std::string_view view) noexcept
+        : m_data(view.data())
+        , m_length(view.size())
+    {
+    }
+
+    ///@}
+
+    /**
+     * @name Operators
+     */
+    ///@{
+
+    /**
+     * @brief Access n-th character of the view.
+     *
+     * In DEBUG mode additional bound checks are performed.
+     *
+     * @param n which character to access, indexing starts at 0
+     * @return const reference to char
+     */
+    constexpr const char& operator[](size_t n) const noexcept
+    {
+#ifdef NDEBUG
+        if (n >= m_length) {
+            std::abort();
+        }
+#endif
+        return m_data[n]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    /**
+     * @brief Compares two views for equality
+     *
+     * @param lhs the first view
+     * @param rhs the second view
+     * @return true, if the viewed contents match,
+     * @return false otherwise
+     */
+    friend constexpr bool operator==(StaticStringView lhs, StaticStringView rhs) noexcept
+    {
+        return lhs.m_length == rhs.m_length
+            && std::char_traits<char>::compare(lhs.m_data, rhs.m_data, lhs.m_length) == 0;
+    }
+
+    /**
+     * @brief Compares two views lexicographically, by character values
+     *        taken as unsigned
+     *
+     * @param lhs the first view
+     * @param rhs the second view
+     * @return the ordering of the first view relative to the second one
+     */
+    friend constexpr std::strong_ordering operator<=>(
+        StaticStringView lhs, StaticStringView rhs) noexcept
+    {
+        const int result = std::char_traits<char>::compare(
+            lhs.m_data, rhs.m_data, std::min(lhs.m_length, rhs.m_length));
+
+        if (result != 0) {
+            return result <=> 0;
+        }
+
+        return lhs.m_length <=> rhs.m_length;
+    }
+
+    ///@}
+
+    /**
+     * @name Size getters
+     */
+    ///@{
+
+    /**
+     * @brief Gets the length of the view
+     *
+     * @return View length, in bytes/characters
+     */
+    [[nodiscard]] constexpr size_t GetSize() const noexcept
+    {
+        return m_length;
+    }
+
+    /**
+     * @brief Gets the length of the view
+     *
+     * @return View length, in bytes/characters
+     */
+    [[nodiscard]] constexpr size_t GetLength() const noexcept
+    {
+        return m_length;
+    }
+
+    /**
+     * @brief Checks, if the view is empty
+     *
+     * @return true if it is empty,
+     * @return false otherwise
+     */
+    [[nodiscard]] constexpr bool IsEmpty() const noexcept
+    {
+        return m_length == 0;
+    }
+
+    ///@}
+
+    /**
+     * @name Conversions
+     */
+    ///@{
+
+    /**
+     * @brief Gets a pointer to the viewed characters, which are not
+     *        necessarily zero-terminated
+     *
+     * @return pointer to the first viewed character
+     */
+    [[nodiscard]] constexpr const char* GetDataPtr() const noexcept
+    {
+        return m_data;
+    }
+
+    /**
+     * @brief Converts the view to std::string_view
+     *
+     * @return a standard view of the same characters
+     */
+    [[nodiscard]] constexpr std::string_view ToStringView() const noexcept
+    {
+        return { m_data, m_length };
+    }
+
+    /**
+     * @brief Provides explicit conversion to std::string_view
+     *
+     * @return a standard view of the same characters
+     */
+    constexpr explicit operator std::string_view() const noexcept
+    {
+        return ToStringView();
+    }
+
+    /**
+     * @brief Parses the whole view as an integer
+     *
+     * A leading '-' is accepted for signed types, no prefixes such as "0x"
+     * are. Decimal numbers are converted 8 digits at a time.
+     *
+     * @tparam T type of integral type
+     * @param base numeric base, from 2 to 36
+     * @return the parsed number and the error code
+     */
+    template <std::integral T>
+    [[nodiscard]] ParseResult<T> Parse(unsigned base = 10) const noexcept
+    {
+        return ParseInteger<T>(m_data, m_length, base);
+    }
+
+    /**
+     * @brief Parses the whole view as a floating-point number
+     *
+     * @tparam T floating-point type
+     * @param format accepted notations, as in std::from_chars()
+     * @return the parsed number and the error code
+     */
+    template <std::floating_point T = double>
+    [[nodiscard]] ParseResult<T> ParseFloat(
+        std::chars_format format = std::chars_format::general) const noexcept
+    {
+        return lg::ParseFloat<T>(m_data, m_length, format);
+    }
+
+    ///@}
+
+    /**
+     * @name Operations
+     */
+    ///@{
+
+    /**
+     * @brief Creates a view of a part of this view
+     *
+     * @param position index of the first character, clamped to the length
+     * @param count maximum number of characters, clamped to the remainder
+     * @return the view of the part
+     */
+    [[nodiscard]] constexpr StaticStringView Substr(size_t position, size_t count = NPOS) const noexcept
+    {
+        position = std::min(position, m_length);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return { m_data + position, std::min(count, m_length - position) };
+    }
+
+    /**
+     * @brief Skips n first characters, in constant time
+     *
+     * @param characters number of characters to skip
+     * @return true, if the operation succeeded,
+     * @return false otherwise
+     */
+    constexpr bool Skip(size_t characters) noexcept
+    {
+        if (characters > m_length) {
+            return false;
+        }
+
+        m_data += characters; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        m_length -= characters;
+        return true;
+    }
+
+    /**
+     * @brief Truncates the view if its length exceeds the provided parameter
+     *
+     * @param length maximum length allowed
+     * @return true, if the view has been truncated,
+     * @return false otherwise
+     */
+    constexpr bool Truncate(size_t length) noexcept
+    {
+        if (length >= m_length) {
+            return false;
+        }
+
+        m_length = length;
+        return true;
+    }
+
+    /**
+     * @brief Checks, if this view starts with the provided characters
+     *
+     * @param other characters to check against
+     * @return true, if the provided characters are the prefix,
+     * @return false otherwise
+     */
+    [[nodiscard]] constexpr bool StartsWith(StaticStringView other) const noexcept
+    {
+        return other.m_length <= m_length
+            && std::char_traits<char>::compare(m_data, other.m_data, other.m_length) == 0;
+    }
+
+    /**
+     * @brief Checks, if this view ends with the provided characters
+     *
+     * @param other characters to check against
+     * @return true, if the provided characters are the suffix,
+     * @return false otherwise
+     */
+    [[nodiscard]] constexpr bool EndsWith(StaticStringView other) const noexcept
+    {
+        return other.m_length <= m_length
+            && Substr(m_length - other.m_length) == other;
+    }
+
+    /**
+     * @brief Finds the first occurrence of a character
+     *
+     * @param c character to search for
+     * @param position index to start the search at
+     * @return index of the occurrence, or NPOS if there is none
+     */
+    [[nodiscard]] size_t Find(char c, size_t position = 0) const noexcept
+    {
+        return FindCharFrom(m_data, m_length, c, position);
+    }
+
+    /**
+     * @brief Finds the first occurrence of a substring
+     *
+     * @param needle substring to search for
+     * @param position index to start the search at
+     * @return index of the occurrence, or NPOS if there is none;
+     *         an empty substring is found at the starting index
+     */
+    [[nodiscard]] size_t Find(StaticStringView needle, size_t position = 0) const noexcept
+    {
+        return FindSubstringFrom(m_data, m_length, needle.m_data, needle.m_length, position);
+    }
+
+    /**
+     * @brief Finds the first character that is any of the provided ones
+     *
+     * @param set characters to search for
+     * @param position index to start the search at
+     * @return index of the occurrence, or NPOS if there is none
+     */
+    [[nodiscard]] size_t FindFirstOf(StaticStringView set, size_t position = 0) const noexcept
+    {
+        return FindFirstOfFrom(m_data, m_length, set.m_data, set.m_length, position);
+    }
+
+    /**
+     * @brief Checks, if the view contains a character
+     *
+     * @param c character to search for
+     * @return true, if the character is present,
+     * @return false otherwise
+     */
+    [[nodiscard]] bool Contains(char c) const noexcept
+    {
+        return Find(c) != NPOS;
+    }
+
+    /**
+     * @brief Checks, if the view contains a substring
+     *
+     * @param needle substring to search for
+     * @return true, if the substring is present,
+     * @return false otherwise
+     */
+    [[nodiscard]] bool Contains(StaticStringView needle) const noexcept
+    {
+        return Find(needle) != NPOS;
+    }
+
+    /**
+     * @brief Counts the occurrences of a character
+     *
+     * @param c character to count
+     * @return number of occurrences
+     */
+    [[nodiscard]] size_t Count(char c) const noexcept
+    {
+        return CountChar(m_data, m_length, c);
+    }
+
+    /**
+     * @brief Counts the non-overlapping occurrences of a substring
+     *
+     * @param needle substring to count, an empty one is never counted
+     * @return number of occurrences
+     */
+    [[nodiscard]] size_t Count(StaticStringView needle) const noexcept
+    {
+        return CountSubstrings(m_data, m_length, needle.m_data, needle.m_length);
+    }
+
+    /**
+     * @brief Splits the view at every occurrence of a delimiter
+     *
+     * Adjacent delimiters produce empty parts, so "a,,b" is split
+     * into "a", "" and "b". An empty view produces a single empty part.
+     *
+     * @param delimiter the delimiting character
+     * @return a range of the parts, viewing the same characters
+     */
+    [[nodiscard]] StaticStringTokens Split(char delimiter) const noexcept;
+
+    /**
+     * @brief Splits the view into tokens separated by runs of delimiters
+     *
+     * Empty tokens are skipped, so " a  b " is tokenized into "a" and "b".
+     *
+     * @param delimiters the delimiting characters, they must outlive the range
+     * @return a range of the tokens, viewing the same characters
+     */
+    [[nodiscard]] StaticStringTokens Tokenize(StaticStringView delimiters) const noexcept;
+
+    /**
+     * @brief Returns a const iterator to the beginning
+     *
+     * @return iterator object
+     */
+    [[nodiscard]] constexpr ConstIterator begin() const noexcept
+    {
+        return m_data;
+    }
+
+    /**
+     * @brief Returns a const iterator to the end
+     *
+     * @return iterator object
+     */
+    [[nodiscard]] constexpr ConstIterator end() const noexcept
+    {
+        return m_data + m_length; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    ///@}
+
+private:
+    const char* m_data { nullptr };
+    size_t m_length { 0 };
+};
+
+/**
+ * @brief A lazily evaluated range of the parts of a StaticStringView,
+ *        returned by StaticStringView::Split() and StaticStringView::Tokenize()
+ */
+class StaticStringTokens {
+public:
+    /**
+     * @brief Forward iterator to the parts
+     */
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = StaticStringView;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const StaticStringView*;
+        using reference = const StaticStringView&;
+
+        Iterator() noexcept = default;
+
+        const StaticStringView& operator*() const noexcept
+        {
+            return m_token;
+        }
+
+        const StaticStringView* operator->() const noexcept
+        {
+            return &m_token;
+        }
+
+        Iterator& operator++() noexcept
+        {
+            Advance();
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept
+        {
+            Iterator previous = *this;
+            Advance();
+            return previous;
+        }
+
+        bool operator==(const Iterator& other) const noexcept
+        {
+            return m_atEnd == other.m_atEnd
+                && (m_atEnd || m_token.GetDataPtr() == other.m_token.GetDataPtr());
+        }
+
+        bool operator==(std::default_sentinel_t) const noexcept
+        {
+            return m_atEnd;
+        }
+
+    private:
+        friend class StaticStringTokens;
+
+        StaticStringView m_remaining;
+        StaticStringView m_token;
+        StaticStringView m_delimiters;
+        char m_delimiter { '\0' };
+        bool m_tokenize { false };
+        bool m_exhausted { false };
+        bool m_atEnd { false };
+
+        void Advance() noexcept
+        {
+            if (m_tokenize) {
+                while (!m_remaining.IsEmpty() && m_delimiters.Contains(m_remaining[0])) {
+                    m_remaining.Skip(1);
+                }
+
+                if (m_remaining.IsEmpty()) {
+                    m_atEnd = true;
+                    return;
+                }
+
+                m_token = m_remaining.Substr(0, m_remaining.FindFirstOf(m_delimiters));
+                m_remaining.Skip(m_token.GetSize());
+            } else {
+                if (m_exhausted) {
+                    m_atEnd = true;
+                    return;
+                }
+
+                const size_t position = m_remaining.Find(m_delimiter);
+                m_token = m_remaining.Substr(0, position);
+
+                if (position == StaticStringView::NPOS) {
+                    m_remaining = {};
+                    m_exhausted = true;
+                } else {
+                    m_remaining.Skip(position + 1);
+                }
+            }
+        }
+    };
+
+    /**
+     * @brief Returns an iterator to the first part
+     *
+     * @return iterator object
+     */
+    [[nodiscard]] Iterator begin() const noexcept
+    {
+        Iterator iterator = m_first;
+        iterator.Advance();
+        return iterator;
+    }
+
+    /**
+     * @brief Returns the end sentinel
+     *
+     * @return sentinel object
+     */
+    [[nodiscard]] std::default_sentinel_t end() const noexcept
+    {
+        return std::default_sentinel;
+    }
+
+private:
+    friend class StaticStringView;
+
+    Iterator m_first;
+
+    StaticStringTokens(StaticStringView view, char delimiter) noexcept
+    {
+        m_first.m_remaining = view;
+        m_first.m_delimiter = delimiter;
+    }
+
+    StaticStringTokens(StaticStringView view, StaticStringView delimiters) noexcept
+    {
+        m_first.m_remaining = view;
+        m_first.m_delimiters = delimiters;
+        m_first.m_tokenize = true;
+    }
+};
+
+inline StaticStringTokens StaticStringView::Split(char delimiter) const noexcept
+{
+    return { *this, delimiter };
+}
+
+inline StaticStringTokens StaticStringView::Tokenize(StaticStringView delimiters) const noexcept
+{
+    return { *this, delimiters };
+}
+
+};
@@ -1,25 +1,260 @@
 #pragma once
-#include <array>
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
+#include <iterator>
+#include <memory>
 #include <type_traits>
 #include <utility>
 
+#include "sizetype.hpp"
+
 namespace lg {
 
+/**
+ * @brief Element operations shared by all StaticVector capacities
+ *
+ * StaticVector is instantiated once per element type and capacity, so
+ * anything written in the class template itself is duplicated for every
+ * capacity in use. The operations that move, construct and destroy elements
+ * live here as functions of a (pointer, length) pair instead, and are
+ * instantiated only once per element type.
+ *
+ * The functions that change the length return the new one and leave storing
+ * it to the caller.
+ *
+ * @tparam T the type of elements
+ */
+template <typename T>
+class StaticVectorBase {
+protected:
+    /**
+     * @brief Compares elements to a value, the predicate of RemoveValue()
+     *
+     * Unlike a lambda, the type is the same for all capacities.
+     */
+    struct ValueEquals {
+        const T& value;
+
+        constexpr bool operator()(const T& element) const
+        {
+            return element == value;
+        }
+    };
+
+    /**
+     * @brief Copy constructs elements into uninitialized storage
+     */
+    template <typename U>
+    static constexpr void ConstructElements(T* data, const U* source, size_t count) noexcept(
+        std::is_nothrow_constructible<T, const U&>::value)
+    {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        for (size_t i = 0; i < count; ++i) {
+            std::construct_at(data + i, source[i]);
+        }
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    /**
+     * @brief Move constructs elements into uninitialized storage
+     */
+    static constexpr void MoveElements(T* data, T* source, size_t count) noexcept(
+        std::is_nothrow_move_constructible<T>::value)
+    {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        for (size_t i = 0; i < count; ++i) {
+            std::construct_at(data + i, std::move(source[i]));
+        }
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    /**
+     * @brief Destroys the elements in the given range of indices
+     */
+    static constexpr void DestroyElements(T* data, size_t first, size_t last) noexcept
+    {
+        // If the class is trivially destructible, we can safely
+        // assume that destructors needn't be called and clear operation can
+        // be sped up. It also keeps the storage initialized during constant
+        // evaluation.
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            std::destroy(data + first, data + last);
+        }
+    }
+
+    /**
+     * @brief Moves a block of elements to another, possibly overlapping
+     *        position, leaving the vacated slots uninitialized
+     *
+     * The destination slots that do not overlap the source must be
+     * uninitialized. For trivially copyable types, this is a single memmove().
+     */
+    static constexpr void Relocate(T* data, size_t from, size_t to, size_t count) noexcept(
+        std::is_nothrow_move_constructible<T>::value)
+    {
+        if (count == 0 || from == to) {
+            return;
+        }
+
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (!std::is_constant_evaluated()) {
+                std::memmove(data + to, data + from, count * sizeof(T));
+                return;
+            }
+        }
+
+        if (to < from) {
+            for (size_t i = 0; i < count; ++i) {
+                std::construct_at(data + to + i, std::move(data[from + i]));
+                DestroyElements(data, from + i, from + i + 1);
+            }
+        } else {
+            for (size_t i = count; i-- > 0;) {
+                std::construct_at(data + to + i, std::move(data[from + i]));
+                DestroyElements(data, from + i, from + i + 1);
+            }
+        }
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    /**
+     * @brief Removes a valid range of elements, shifting the following
+     *        ones down
+     *
+     * @return the new length
+     */
+    static constexpr size_t EraseElements(T* data, size_t size, size_t first, size_t last)
+    {
+        DestroyElements(data, first, last);
+        Relocate(data, last, first, size - last);
+        return size - (last - first);
+    }
+
+    /**
+     * @brief Removes a valid element by moving the last one into its place
+     *
+     * @return the new length
+     */
+    static constexpr size_t SwapRemoveElement(T* data, size_t size, size_t index)
+    {
+        --size;
+
+        if (index != size) {
+            data[index] = std::move(data[size]);
+        }
+
+        DestroyElements(data, size, size + 1);
+        return size;
+    }
+
+    /**
+     * @brief Removes the elements satisfying a predicate, preserving
+     *        the order of the remaining ones
+     *
+     * @return the new length
+     */
+    template <typename Predicate>
+    static constexpr size_t RemoveElementsIf(T* data, size_t size, Predicate& predicate)
+    {
+        size_t write_ptr = 0;
+
+        for (size_t read_ptr = 0; read_ptr < size; ++read_ptr) {
+            if (!predicate(std::as_const(data[read_ptr]))) {
+                if (write_ptr != read_ptr) {
+                    data[write_ptr] = std::move(data[read_ptr]);
+                }
+                ++write_ptr;
+            }
+        }
+
+        DestroyElements(data, write_ptr, size);
+        return write_ptr;
+    }
+
+    /**
+     * @brief Constructs an element at the given index, shifting the following
+     *        elements up, or at the end if the index is past the end
+     *
+     * @return false if there is no room for the element
+     */
+    template <typename... Args>
+    static constexpr bool EmplaceElement(
+        T* data, size_t size, size_t capacity, size_t index, Args&&... args)
+    {
+        if (size == capacity) {
+            return false;
+        }
+
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if (index >= size) {
+            std::construct_at(data + size, std::forward<Args>(args)...);
+            return true;
+        }
+
+        // The arguments may refer to an element about to be shifted
+        T element(std::forward<Args>(args)...);
+
+        Relocate(data, index, index + 1, size - index);
+        std::construct_at(data + index, std::move(element));
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        return true;
+    }
+
+    /**
+     * @brief Constructs a range of elements at the given index, shifting
+     *        the following elements up and dropping those that do not fit
+     *
+     * @return the number of elements inserted
+     */
+    template <typename It>
+    static constexpr size_t InsertElements(
+        T* data, size_t size, size_t capacity, size_t index, It first, It last)
+    {
+        index = std::min(index, size);
+        const size_t count = std::min(capacity - size,
+            static_cast<size_t>(std::distance(first, last)));
+
+        Relocate(data, index, index + count, size - index);
+
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        for (size_t i = 0; i < count; ++i, ++first) {
+            std::construct_at(data + index + i, *first);
+        }
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        return count;
+    }
+};
+
 /**
  * @brief A dynamically sized array using only statically allocated memory.
  *
  * This class can store any elements of the provided type, up to its capacity.
  * Any extra elements will be dropped during its internal operations.
  *
+ * The storage is left uninitialized, so T doesn't have to be default
+ * constructible and creating or clearing a vector costs nothing for the unused
+ * capacity. Elements are constructed in place when added and destroyed when
+ * removed.
+ *
+ * The whole API is constexpr, so a vector can be built by a consteval
+ * function and stored in a constexpr variable, e.g. as a lookup table placed
+ * in read-only memory. That requires T to be a default constructible literal
+ * type with a trivial destructor.
+ *
  * StaticVector will never throw any exceptions.
  *
- * @tparam T the type of elements to be stored, should be default constructible
+ * @tparam T the type of elements to be stored
  * @tparam maxSize Vector capacity, in elements
  */
 template <typename T, std::size_t maxSize>
-class StaticVector {
+class StaticVector : private StaticVectorBase<T> {
+    using Base = StaticVectorBase<T>;
+
 public:
     static_assert(maxSize > 0, "vector capacity must be greater than 0");
 
@@ -43,13 +278,36 @@ public:
 
     /**
      * @brief Default constructor, initializes an empty vector
+     *
+     * During constant evaluation, the unused capacity is value-initialized
+     * if T allows it, which lets a vector built at compile time be stored
+     * in a constexpr variable.
      */
-    constexpr StaticVector() noexcept = default;
+    constexpr StaticVector() noexcept
+    {
+        if (std::is_constant_evaluated()) {
+            if constexpr (std::is_default_constructible<T>::value) {
+                for (size_t i = 0; i < maxSize; ++i) {
+                    std::construct_at(&m_buffer[i]);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Destructor, destroys all the elements
+     */
+    constexpr ~StaticVector()
+    {
+        Clear();
+    }
 
     /**
-     * @brief Default destructor
+     * @brief Trivial destructor for trivially destructible types
      */
-    ~StaticVector() = default;
+    constexpr ~StaticVector()
+        requires std::is_trivially_destructible<T>::value
+    = default;
 
     /**
      * @brief Copy constructor, copies contents of another StaticVector instance.
@@ -59,9 +317,11 @@ public:
      * @param other vector to copy contents from
      */
     template <typename U, std::size_t otherSize>
-    constexpr StaticVector(const StaticVector<U, otherSize>& other) noexcept
+    constexpr StaticVector(const StaticVector<U, otherSize>& other) noexcept(
+        std::is_nothrow_constructible<T, const U&>::value)
+        : StaticVector()
     {
-        *this = other;
+        ConstructFrom(other.m_buffer, std::min<size_t>(maxSize, other.m_currentSize));
     }
 
     /**
@@ -69,21 +329,26 @@ public:
      *
      * @param other vector to copy contents from
      */
-    constexpr StaticVector(const StaticVector& other) noexcept
+    constexpr StaticVector(const StaticVector& other) noexcept(
+        std::is_nothrow_copy_constructible<T>::value)
+        : StaticVector()
     {
-        *this = other;
+        ConstructFrom(other.m_buffer, other.m_currentSize);
     }
 
     /**
-     * @brief Move constructor, copies contents of another StaticVector instance.
+     * @brief Move constructor, moves contents of another StaticVector instance
+     *        element by element.
      *
-     * It performs exactly the same as a copy constructor.
+     * The other vector is left empty.
      *
-     * @param other vector to copy contents from
+     * @param other vector to move contents from
      */
-    constexpr StaticVector(StaticVector&& other) noexcept
+    constexpr StaticVector(StaticVector&& other) noexcept(
+        std::is_nothrow_move_constructible<T>::value)
+        : StaticVector()
     {
-        *this = other;
+        MoveFrom(other);
     }
 
     ///@}
@@ -102,11 +367,11 @@ public:
      * @return reference to self
      */
     template <typename U, std::size_t otherSize>
-    constexpr StaticVector& operator=(const StaticVector<U, otherSize>& other) noexcept
+    constexpr StaticVector& operator=(const StaticVector<U, otherSize>& other) noexcept(
+        std::is_nothrow_constructible<T, const U&>::value)
     {
-        m_currentSize = std::min(maxSize, other.m_currentSize);
-        std::copy(other.m_buffer.begin(),
-            other.m_buffer.begin() + m_currentSize, m_buffer.begin());
+        Clear();
+        ConstructFrom(other.m_buffer, std::min<size_t>(maxSize, other.m_currentSize));
 
         return *this;
     }
@@ -117,26 +382,34 @@ public:
      * @param other the instance of the second vector
      * @return reference to self
      */
-    constexpr StaticVector& operator=(const StaticVector& other) noexcept
+    constexpr StaticVector& operator=(const StaticVector& other) noexcept(
+        std::is_nothrow_copy_constructible<T>::value)
     {
-        std::copy(other.m_buffer.begin(),
-            other.m_buffer.begin() + other.m_currentSize, m_buffer.begin());
-        m_currentSize = other.m_currentSize;
+        if (this != &other) {
+            Clear();
+            ConstructFrom(other.m_buffer, other.m_currentSize);
+        }
 
         return *this;
     }
 
     /**
-     * @brief Move assignment operator, copies contents of another vector
+     * @brief Move assignment operator, moves contents of another vector
+     *        element by element
      *
-     * It performs exactly the same as a copy constructor.
+     * The other vector is left empty, unless it is this vector.
      *
      * @param other the instance of the second vector
      * @return reference to self
      */
-    constexpr StaticVector& operator=(StaticVector&& other) noexcept
+    constexpr StaticVector& operator=(StaticVector&& other) noexcept(
+        std::is_nothrow_move_constructible<T>::value)
     {
-        *this = other;
+        if (this != &other) {
+            Clear();
+            MoveFrom(other);
+        }
+
         return *this;
     }
 
@@ -148,7 +421,7 @@ public:
      * @param n which element to access, indexing starts at 0
      * @return reference to element
      */
-    T& operator[](size_t n) noexcept
+    constexpr T& operator[](size_t n) noexcept
     {
 #ifdef NDEBUG
         if (n >= m_currentSize) {
@@ -166,7 +439,7 @@ public:
      * @param n which element to access, indexing starts at 0
      * @return const reference to element
      */
-    const T& operator[](size_t n) const noexcept
+    constexpr const T& operator[](size_t n) const noexcept
     {
 #ifdef NDEBUG
         if (n >= m_currentSize) {
@@ -208,7 +481,7 @@ public:
      *
      * @return elements count
      */
-    [[nodiscard]] size_t GetSize() const noexcept
+    [[nodiscard]] constexpr size_t GetSize() const noexcept
     {
         return m_currentSize;
     }
@@ -219,7 +492,7 @@ public:
      * @return true if it is empty,
      * @return false otherwise
      */
-    [[nodiscard]] bool IsEmpty() const noexcept
+    [[nodiscard]] constexpr bool IsEmpty() const noexcept
     {
         return m_currentSize == 0;
     }
@@ -236,9 +509,9 @@ public:
      *
      * @return const pointer to vector data
      */
-    [[nodiscard]] const T* GetDataPtr() const noexcept
+    [[nodiscard]] constexpr const T* GetDataPtr() const noexcept
     {
-        return m_buffer.data();
+        return m_buffer;
     }
 
     /**
@@ -248,14 +521,9 @@ public:
      * @return true, if the operation succeeded (vector wasn't full),
      * @return false otherwise
      */
-    bool Append(const T& element) noexcept
+    constexpr bool Append(const T& element) noexcept
     {
-        if (m_currentSize < maxSize) {
-            m_buffer[m_currentSize++] = element;
-            return true;
-        }
-
-        return false;
+        return EmplaceBack(element);
     }
 
     /**
@@ -265,10 +533,25 @@ public:
      * @return true, if the operation succeeded (vector wasn't full),
      * @return false otherwise
      */
-    bool Append(T&& element) noexcept
+    constexpr bool Append(T&& element) noexcept
+    {
+        return EmplaceBack(std::move(element));
+    }
+
+    /**
+     * @brief Constructs a single element in place at the end of the vector
+     *
+     * @tparam Args types of the constructor arguments
+     * @param args arguments forwarded to the constructor of T
+     * @return true, if the operation succeeded (vector wasn't full),
+     * @return false otherwise
+     */
+    template <typename... Args>
+    constexpr bool EmplaceBack(Args&&... args) noexcept
     {
         if (m_currentSize < maxSize) {
-            m_buffer[m_currentSize++] = std::move(element);
+            std::construct_at(&m_buffer[m_currentSize], std::forward<Args>(args)...);
+            ++m_currentSize;
             return true;
         }
 
@@ -279,13 +562,9 @@ public:
      * @brief Clears the vector
      *
      */
-    void Clear() noexcept
+    constexpr void Clear() noexcept
     {
-        // If the class is trivially destructible, we can safely
-        // assume that destructors needn't be called and clear operation can
-        // be sped up.
-
-        ClearInternal(std::is_trivially_destructible<T> {});
+        Base::DestroyElements(m_buffer, 0, m_currentSize);
         m_currentSize = 0;
     }
 
@@ -296,46 +575,81 @@ public:
      * @return true, if the operation succeeded (index was in a valid range),
      * @return false otherwise
      */
-    bool RemoveIndex(size_t index)
+    constexpr bool RemoveIndex(size_t index)
+    {
+        return EraseRange(index, index + 1);
+    }
+
+    /**
+     * @brief Removes an item specified by its index in constant time,
+     *        moving the last element into its place
+     *
+     * The order of the elements is not preserved.
+     *
+     * @param index index of the element to be removed
+     * @return true, if the operation succeeded (index was in a valid range),
+     * @return false otherwise
+     */
+    constexpr bool SwapRemove(size_t index)
     {
         if (index >= m_currentSize)
             return false;
 
-        m_buffer[index] = T {};
-        --m_currentSize;
+        m_currentSize = static_cast<SizeType>(Base::SwapRemoveElement(m_buffer, m_currentSize, index));
+        return true;
+    }
 
-        for (size_t i = index; i < m_currentSize; ++i) {
-            std::swap(m_buffer[i], m_buffer[i + 1]);
-        }
+    /**
+     * @brief Removes a range of elements specified by their indices
+     *
+     * The following elements are shifted down at once, which for trivially
+     * copyable types boils down to a single memmove() call.
+     *
+     * @param first index of the first element to be removed
+     * @param last index one past the last element to be removed
+     * @return true, if the operation succeeded (range was valid),
+     * @return false otherwise
+     */
+    constexpr bool EraseRange(size_t first, size_t last)
+    {
+        if (first > last || last > m_currentSize)
+            return false;
 
+        m_currentSize = static_cast<SizeType>(Base::EraseElements(m_buffer, m_currentSize, first, last));
         return true;
     }
 
     /**
      * @brief Removes all value occurences from the vector
      *
-     * @param value value to be removed
+     * @sa RemoveIf()
+     *
+     * @param value value to be removed, must not refer to an element
+     *              of this vector
      * @return number of removed elements
      */
-    size_t RemoveValue(const T& value)
+    constexpr size_t RemoveValue(const T& value)
     {
-        size_t removed = 0;
-
-        size_t write_ptr = 0;
-
-        for (size_t read_ptr = 0; read_ptr < m_currentSize; ++read_ptr) {
-            if (m_buffer[read_ptr] == value) {
-                m_buffer[read_ptr] = T {};
-                ++removed;
-            } else {
-                if (write_ptr != read_ptr) {
-                    std::swap(m_buffer[read_ptr], m_buffer[write_ptr]);
-                }
-                ++write_ptr;
-            }
-        }
+        return RemoveIf(typename Base::ValueEquals { value });
+    }
 
-        m_currentSize -= removed;
+    /**
+     * @brief Removes all elements satisfying a predicate from the vector,
+     *        preserving the order of the remaining ones
+     *
+     * The remaining elements are moved down in a single pass and the leftover
+     * tail is destroyed once at the end.
+     *
+     * @tparam Predicate a callable taking const T& and returning bool
+     * @param predicate returns true for the elements to be removed
+     * @return number of removed elements
+     */
+    template <typename Predicate>
+    constexpr size_t RemoveIf(Predicate predicate)
+    {
+        const size_t size = Base::RemoveElementsIf(m_buffer, m_currentSize, predicate);
+        const size_t removed = m_currentSize - size;
+        m_currentSize = static_cast<SizeType>(size);
         return removed;
     }
 
@@ -347,18 +661,9 @@ public:
      * @return true, if the operation succeeded,
      * @return false otherwise
      */
-    bool Insert(size_t index, const T& value)
+    constexpr bool Insert(size_t index, const T& value)
     {
-        size_t rotateCount = m_currentSize - index;
-        if (rotateCount > maxSize)
-            rotateCount = 0;
-
-        if (Append(value)) {
-            InsertRotateLeft(rotateCount);
-            return true;
-        }
-
-        return false;
+        return EmplaceAt(index, value);
     }
 
     /**
@@ -369,18 +674,51 @@ public:
      * @return true, if the operation succeeded,
      * @return false otherwise
      */
-    bool Insert(size_t index, T&& value)
+    constexpr bool Insert(size_t index, T&& value)
     {
-        size_t rotateCount = m_currentSize - index;
-        if (rotateCount > maxSize)
-            rotateCount = 0;
+        return EmplaceAt(index, std::move(value));
+    }
 
-        if (Append(std::move(value))) {
-            InsertRotateLeft(rotateCount);
-            return true;
-        }
+    /**
+     * @brief Insert a range of elements at the specified index
+     *
+     * The following elements are shifted up at once, which for trivially
+     * copyable types boils down to a single memmove() call. Elements that
+     * do not fit are dropped. The range must not point into this vector.
+     *
+     * @tparam It forward iterator type, must dereference to a type that T can be
+     *            constructed from
+     * @param index index of the element **before** which the elements will be placed
+     * @param first an iterator to the beginning of the range
+     * @param last an iterator to the end of the range
+     * @return the number of elements inserted
+     */
+    template <typename It>
+    constexpr size_t InsertRange(size_t index, It first, It last)
+    {
+        static_assert(std::forward_iterator<It>, "The provided iterator is not a forward iterator");
 
-        return false;
+        const size_t count = Base::InsertElements(m_buffer, m_currentSize, maxSize, index, first, last);
+        m_currentSize = static_cast<SizeType>(m_currentSize + count);
+        return count;
+    }
+
+    /**
+     * @brief Appends a range of elements to the vector
+     *
+     * Elements that do not fit are dropped. The range must not point into
+     * this vector.
+     *
+     * @tparam It forward iterator type, must dereference to a type that T can be
+     *            constructed from
+     * @param first an iterator to the beginning of the range
+     * @param last an iterator to the end of the range
+     * @return the number of elements appended
+     */
+    template <typename It>
+    constexpr size_t AppendRange(It first, It last)
+    {
+        return InsertRange(m_currentSize, first, last);
     }
 
     /**
@@ -388,9 +726,9 @@ public:
      *
      * @return iterator object
      */
-    [[nodiscard]] Iterator begin() noexcept
+    [[nodiscard]] constexpr Iterator begin() noexcept
     {
-        return m_buffer.begin();
+        return m_buffer;
     }
 
     /**
@@ -398,9 +736,9 @@ public:
      *
      * @return iterator object
      */
-    [[nodiscard]] ConstIterator begin() const noexcept
+    [[nodiscard]] constexpr ConstIterator begin() const noexcept
     {
-        return m_buffer.begin();
+        return m_buffer;
     }
 
     /**
@@ -408,9 +746,9 @@ public:
      *
      * @return iterator object
      */
-    [[nodiscard]] Iterator end() noexcept
+    [[nodiscard]] constexpr Iterator end() noexcept
     {
-        return m_buffer.begin() + m_currentSize;
+        return m_buffer + m_currentSize;
     }
 
     /**
@@ -418,38 +756,81 @@ public:
      *
      * @return iterator object
      */
-    [[nodiscard]] ConstIterator end() const noexcept
+    [[nodiscard]] constexpr ConstIterator end() const noexcept
     {
-        return m_buffer.begin() + m_currentSize;
+        return m_buffer + m_currentSize;
     }
 
     ///@}
 
 private:
-    size_t m_currentSize { 0 };
-    std::array<T, maxSize> m_buffer;
+    /**
+     * @brief The smallest unsigned type able to hold the vector size
+     */
+    using SizeType = MinimalSizeType<maxSize>;
 
-    void InsertRotateLeft(size_t times)
-    {
-        T* element1 = m_buffer.begin() + m_currentSize - 1;
-        T* element2 = m_buffer.begin() + m_currentSize - 2;
+    // Uninitialized storage, elements are constructed and destroyed in place.
+    // It goes first, so that the size fills what would be tail padding.
+    union {
+        T m_buffer[maxSize]; // NOLINT(*-avoid-c-arrays)
+    };
 
-        while (times--) {
-            std::swap(*element1, *element2);
-            --element1;
-            --element2;
-        }
+    SizeType m_currentSize { 0 };
+
+    template <typename U>
+    constexpr void ConstructFrom(const U* source, size_t count) noexcept(
+        std::is_nothrow_constructible<T, const U&>::value)
+    {
+        Base::ConstructElements(m_buffer, source, count);
+        m_currentSize = static_cast<SizeType>(count);
     }
 
-    void ClearInternal(std::true_type)
+    constexpr void MoveFrom(StaticVector& other) noexcept(
+        std::is_nothrow_move_constructible<T>::value)
     {
+        Base::MoveElements(m_buffer, other.m_buffer, other.m_currentSize);
+        m_currentSize = other.m_currentSize;
+        other.Clear();
     }
 
-    void ClearInternal(std::false_type)
+    /**
+     * @brief Constructs an element at the given index, shifting the following
+     *        elements up, or at the end if the index is past the end
+     */
+    template <typename... Args>
+    constexpr bool EmplaceAt(size_t index, Args&&... args)
     {
-        for (size_t i = 0; i < m_currentSize; ++i)
-            m_buffer[i] = T {};
+        if (!Base::EmplaceElement(m_buffer, m_currentSize, maxSize, index, std::forward<Args>(args)...)) {
+            return false;
+        }
+
+        ++m_currentSize;
+        return true;
     }
 };
 
+/**
+ * @brief Constructs a StaticVector instance from an array of elements
+ *
+ * This function will automatically deduce the minimal capacity of the created
+ * vector and thus should only be used for const instances, e.g.
+ * `constexpr auto TABLE = VEC({ 1, 2, 3 });`.
+ *
+ * To create a StaticVector instance with an arbitrary capacity,
+ * see @ref StaticVector constructors.
+ *
+ * @tparam T deduced type of elements
+ * @tparam arrayLength deduced number of elements
+ * @param elements reference to the array
+ * @return a StaticVector instance with deduced capacity
+ */
+template <typename T, size_t arrayLength>
+inline consteval StaticVector<T, arrayLength> VEC(
+    const T (&elements)[arrayLength]) // NOLINT(*-avoid-c-arrays)
+{
+    StaticVector<T, arrayLength> result;
+    result.AppendRange(elements, elements + arrayLength);
+    return result;
+}
+
 };
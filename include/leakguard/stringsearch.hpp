@@ -0,0 +1,374 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace lg {
+
+/**
+ * @name Character search kernels
+ *
+ * Building blocks of StaticString searches, operating on plain character
+ * ranges. They process 16 characters at a time with SSE2 where available
+ * and 8 characters at a time in a 64-bit word (SWAR) otherwise, never
+ * reading past the end of the range.
+ */
+///@{
+
+/**
+ * @brief A word with every byte set to 0x01
+ */
+inline constexpr std::uint64_t SWAR_ONES = 0x0101010101010101ULL;
+
+/**
+ * @brief A word with every byte set to 0x7F
+ */
+inline constexpr std::uint64_t SWAR_LOWS = 0x7F7F7F7F7F7F7F7FULL;
+
+/**
+ * @brief Marks zero bytes in a word
+ *
+ * Unlike the common `(x - ONES) & ~x & HIGHS` test, this one has no false
+ * positives after the first zero byte, so the marks can be counted.
+ *
+ * @param word the word to test
+ * @return a word with 0x80 in place of every zero byte and 0 elsewhere
+ */
+inline constexpr std::uint64_t SwarZeroBytes(std::uint64_t word) noexcept
+{
+    return ~(((word & SWAR_LOWS) + SWAR_LOWS) | word | SWAR_LOWS);
+}
+
+/**
+ * @brief Loads up to 8 characters into a word, in memory order
+ *
+ * @param data pointer to the characters
+ * @param count number of characters to load, at most 8
+ * @return the loaded word, with unused bytes set to 0
+ */
+inline std::uint64_t SwarLoad(const char* data, std::size_t count) noexcept
+{
+    std::uint64_t word = 0;
+
+    if (count == sizeof(word)) {
+        std::memcpy(&word, data, sizeof(word));
+    } else {
+        std::memcpy(&word, data, count);
+    }
+
+    return word;
+}
+
+/**
+ * @brief Gets a mask of the bytes filled by SwarLoad()
+ *
+ * @param count number of characters loaded
+ * @return a word with all bits set in the loaded bytes
+ */
+inline constexpr std::uint64_t SwarValidBytes(std::size_t count) noexcept
+{
+    if (count >= sizeof(std::uint64_t)) {
+        return ~std::uint64_t { 0 };
+    }
+
+    if constexpr (std::endian::native == std::endian::little) {
+        return (std::uint64_t { 1 } << (count * 8)) - 1;
+    } else {
+        return ~(~std::uint64_t { 0 } >> (count * 8));
+    }
+}
+
+/**
+ * @brief Gets the memory position of the first marked byte in a word
+ *
+ * @param marks a nonzero word returned by SwarZeroBytes()
+ * @return position of the first marked byte
+ */
+inline constexpr std::size_t SwarFirstByte(std::uint64_t marks) noexcept
+{
+    if constexpr (std::endian::native == std::endian::little) {
+        return static_cast<std::size_t>(std::countr_zero(marks)) / 8;
+    } else {
+        return static_cast<std::size_t>(std::countl_zero(marks)) / 8;
+    }
+}
+
+/**
+ * @brief Finds the first occurrence of a character
+ *
+ * @param data pointer to the characters
+ * @param length number of characters
+ * @param c character to search for
+ * @return position of the first occurrence, or length if there is none
+ */
+inline std::size_t FindChar(const char* data, std::size_t length, char c) noexcept
+{
+    std::size_t offset = 0;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+#if defined(__SSE2__)
+    const __m128i needle = _mm_set1_epi8(c);
+    for (; offset + sizeof(__m128i) <= length; offset += sizeof(__m128i)) {
+        // NOLINTNEXTLINE(*-reinterpret-cast)
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+        const auto matches = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle)));
+
+        if (matches != 0) {
+            return offset + static_cast<std::size_t>(std::countr_zero(matches));
+        }
+    }
+#endif
+
+    const std::uint64_t pattern = SWAR_ONES * static_cast<unsigned char>(c);
+    for (; offset < length; offset += sizeof(std::uint64_t)) {
+        const std::size_t count = std::min(sizeof(std::uint64_t), length - offset);
+        const std::uint64_t matches
+            = SwarZeroBytes(SwarLoad(data + offset, count) ^ pattern) & SwarValidBytes(count);
+
+        if (matches != 0) {
+            return offset + SwarFirstByte(matches);
+        }
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    return length;
+}
+
+/**
+ * @brief Counts the occurrences of a character
+ *
+ * @param data pointer to the characters
+ * @param length number of characters
+ * @param c character to count
+ * @return number of occurrences
+ */
+inline std::size_t CountChar(const char* data, std::size_t length, char c) noexcept
+{
+    std::size_t offset = 0;
+    std::size_t result = 0;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+#if defined(__SSE2__)
+    const __m128i needle = _mm_set1_epi8(c);
+    for (; offset + sizeof(__m128i) <= length; offset += sizeof(__m128i)) {
+        // NOLINTNEXTLINE(*-reinterpret-cast)
+        const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+        const auto matches = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle)));
+        result += static_cast<std::size_t>(std::popcount(matches));
+    }
+#endif
+
+    const std::uint64_t pattern = SWAR_ONES * static_cast<unsigned char>(c);
+    for (; offset < length; offset += sizeof(std::uint64_t)) {
+        const std::size_t count = std::min(sizeof(std::uint64_t), length - offset);
+        const std::uint64_t matches
+            = SwarZeroBytes(SwarLoad(data + offset, count) ^ pattern) & SwarValidBytes(count);
+        result += static_cast<std::size_t>(std::popcount(matches));
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    return result;
+}
+
+/**
+ * @brief Finds the first character that belongs to a set
+ *
+ * A single-character set is searched with FindChar(), larger ones
+ * through a 256-bit membership table.
+ *
+ * @param data pointer to the characters
+ * @param length number of characters
+ * @param set pointer to the set characters
+ * @param setLength number of set characters
+ * @return position of the first occurrence, or length if there is none
+ */
+inline std::size_t FindFirstOfChars(
+    const char* data, std::size_t length, const char* set, std::size_t setLength) noexcept
+{
+    if (setLength == 1) {
+        return FindChar(data, length, *set);
+    }
+
+    static constexpr unsigned WORD_BITS = 64;
+    std::array<std::uint64_t, 4> members {};
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (std::size_t i = 0; i < setLength; ++i) {
+        const auto c = static_cast<unsigned char>(set[i]);
+        members[c / WORD_BITS] |= std::uint64_t { 1 } << (c % WORD_BITS);
+    }
+
+    for (std::size_t i = 0; i < length; ++i) {
+        const auto c = static_cast<unsigned char>(data[i]);
+        if (((members[c / WORD_BITS] >> (c % WORD_BITS)) & 1U) != 0) {
+            return i;
+        }
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    return length;
+}
+
+/**
+ * @brief Finds the first occurrence of a substring
+ *
+ * Candidates are located with FindChar() on the first character of
+ * the substring and then verified with memcmp().
+ *
+ * @param data pointer to the characters
+ * @param length number of characters
+ * @param needle pointer to the substring characters
+ * @param needleLength number of substring characters
+ * @return position of the first occurrence, or length if there is none;
+ *         an empty substring is found at position 0
+ */
+inline std::size_t FindSubstring(
+    const char* data, std::size_t length, const char* needle, std::size_t needleLength) noexcept
+{
+    if (needleLength == 0) {
+        return 0;
+    }
+
+    if (needleLength > length) {
+        return length;
+    }
+
+    const std::size_t lastCandidate = length - needleLength;
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (std::size_t offset = 0; offset <= lastCandidate; ++offset) {
+        offset += FindChar(data + offset, lastCandidate + 1 - offset, *needle);
+
+        if (offset > lastCandidate) {
+            break;
+        }
+
+        if (std::memcmp(data + offset + 1, needle + 1, needleLength - 1) == 0) {
+            return offset;
+        }
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    return length;
+}
+
+///@}
+
+/**
+ * @name Searches starting at a position
+ *
+ * The searches shared by StaticString and StaticStringView, built on
+ * the kernels above. Positions are relative to the start of the whole range,
+ * and a failed search returns SEARCH_NPOS rather than the length.
+ */
+///@{
+
+/**
+ * @brief Position returned by searches that found nothing
+ */
+inline constexpr std::size_t SEARCH_NPOS = static_cast<std::size_t>(-1);
+
+/**
+ * @brief Finds the first occurrence of a character at or after a position
+ *
+ * @param data pointer to the characters
+ * @param length number of characters
+ * @param c character to search for
+ * @param position index to start the search at
+ * @return position of the first occurrence, or SEARCH_NPOS
+ */
+inline std::size_t FindCharFrom(
+    const char* data, std::size_t length, char c, std::size_t position) noexcept
+{
+    if (position >= length) {
+        return SEARCH_NPOS;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const std::size_t found = FindChar(data + position, length - position, c);
+    return position + found < length ? position + found : SEARCH_NPOS;
+}
+
+/**
+ * @brief Finds the first occurrence of a substring at or after a position
+ *
+ * @param data pointer to the characters
+ * @param length number of characters
+ * @param needle pointer to the substring characters
+ * @param needleLength number of substring characters
+ * @param position index to start the search at
+ * @return position of the first occurrence, or SEARCH_NPOS;
+ *         an empty substring is found at the starting position
+ */
+inline std::size_t FindSubstringFrom(const char* data, std::size_t length,
+    const char* needle, std::size_t needleLength, std::size_t position) noexcept
+{
+    if (position > length) {
+        return SEARCH_NPOS;
+    }
+
+    const std::size_t remaining = length - position;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const std::size_t found = FindSubstring(data + position, remaining, needle, needleLength);
+    return found < remaining || needleLength == 0 ? position + found : SEARCH_NPOS;
+}
+
+/**
+ * @brief Finds the first character that belongs to a set at or after
+ *        a position
+ *
+ * @param data pointer to the characters
+ * @param length number of characters
+ * @param set pointer to the set characters
+ * @param setLength number of set characters
+ * @param position index to start the search at
+ * @return position of the first occurrence, or SEARCH_NPOS
+ */
+inline std::size_t FindFirstOfFrom(const char* data, std::size_t length,
+    const char* set, std::size_t setLength, std::size_t position) noexcept
+{
+    if (position >= length) {
+        return SEARCH_NPOS;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const std::size_t found = FindFirstOfChars(data + position, length - position, set, setLength);
+    return position + found < length ? position + found : SEARCH_NPOS;
+}
+
+/**
+ * @brief Counts the non-overlapping occurrences of a substring
+ *
+ * @param data pointer to the characters
+ * @param length number of characters
+ * @param needle pointer to the substring characters
+ * @param needleLength number of substring characters
+ * @return number of occurrences, an empty substring is never counted
+ */
+inline std::size_t CountSubstrings(
+    const char* data, std::size_t length, const char* needle, std::size_t needleLength) noexcept
+{
+    if (needleLength == 0) {
+        return 0;
+    }
+
+    std::size_t result = 0;
+    for (std::size_t position = FindSubstringFrom(data, length, needle, needleLength, 0);
+         position != SEARCH_NPOS;
+         position = FindSubstringFrom(data, length, needle, needleLength, position + needleLength)) {
+        ++result;
+    }
+
+    return result;
+}
+
+///@}
+
+};
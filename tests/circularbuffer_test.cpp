@@ -0,0 +1,478 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "leakguard/circularbuffer.hpp"
+#include "tracked.hpp"
+
+namespace {
+
+using lg::CircularBuffer;
+using lg::CountingStatsImpl;
+using lg::NopMutexImpl;
+using lg::NopStatsImpl;
+using lg::OverflowPolicy;
+using lg::test::Tracked;
+
+template <typename Buffer>
+class CircularBufferTest : public testing::Test { };
+
+// Power-of-two and other capacities, the narrowest index type wrapping
+// at 2 * size, and the cache-line-padded layout
+using Buffers = testing::Types<
+    CircularBuffer<std::uint32_t, 4>,
+    CircularBuffer<std::uint32_t, 5>,
+    CircularBuffer<std::uint32_t, 128>,
+    CircularBuffer<std::uint32_t, 255>,
+    CircularBuffer<std::uint32_t, 4, NopMutexImpl, OverflowPolicy::Reject, NopStatsImpl, 64>,
+    CircularBuffer<std::uint32_t, 5, NopMutexImpl, OverflowPolicy::Reject, NopStatsImpl, 64>>;
+
+TYPED_TEST_SUITE(CircularBufferTest, Buffers);
+
+static_assert(std::is_same_v<
+    lg::RingBuffer<std::uint32_t, 4, NopMutexImpl, OverflowPolicy::Reject, NopStatsImpl, 64>,
+    CircularBuffer<std::uint32_t, 4, NopMutexImpl, OverflowPolicy::Reject, NopStatsImpl, 64>>);
+
+/**
+ * @brief Moves the read and write index forward without storing anything,
+ *        so that the next elements are stored across the end of the storage
+ */
+template <typename Buffer>
+void AdvanceBy(Buffer& buffer, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i) {
+        ASSERT_TRUE(buffer.PushOne(0));
+        ASSERT_TRUE(buffer.Pop());
+    }
+}
+
+TYPED_TEST(CircularBufferTest, StartsEmpty)
+{
+    TypeParam buffer;
+    std::uint32_t out = 42;
+
+    EXPECT_TRUE(buffer.IsEmpty());
+    EXPECT_EQ(buffer.GetCurrentSize(), 0);
+    EXPECT_FALSE(buffer.Pop());
+    EXPECT_EQ(buffer.PopMany(3), 0);
+    EXPECT_FALSE(buffer.PeekAndPop(out));
+    EXPECT_EQ(out, 42);
+    EXPECT_EQ(buffer.begin(), buffer.end());
+}
+
+TYPED_TEST(CircularBufferTest, RejectsPushesWhenFull)
+{
+    TypeParam buffer;
+    const std::size_t capacity = buffer.GetCapacity();
+
+    for (std::uint32_t i = 0; i < capacity; ++i) {
+        ASSERT_TRUE(buffer.PushOne(i));
+    }
+
+    EXPECT_EQ(buffer.GetCurrentSize(), capacity);
+    EXPECT_FALSE(buffer.PushOne(99));
+    EXPECT_FALSE(buffer.Emplace(99U));
+    EXPECT_TRUE(buffer.AcquireWriteRegion().empty());
+
+    const std::array<std::uint32_t, 2> more { 1, 2 };
+    EXPECT_EQ(buffer.PushMany(std::span<const std::uint32_t>(more)), 0);
+
+    ASSERT_TRUE(buffer.Pop());
+    EXPECT_EQ(buffer.PushMany(std::span<const std::uint32_t>(more)), 1);
+    EXPECT_EQ(buffer.GetCurrentSize(), capacity);
+
+    std::uint32_t out = 0;
+    for (std::uint32_t i = 1; i < capacity; ++i) {
+        ASSERT_TRUE(buffer.PeekAndPop(out));
+        EXPECT_EQ(out, i);
+    }
+
+    ASSERT_TRUE(buffer.PeekAndPop(out));
+    EXPECT_EQ(out, 1);
+    EXPECT_TRUE(buffer.IsEmpty());
+}
+
+TYPED_TEST(CircularBufferTest, PeeksAtTheOldestElement)
+{
+    TypeParam buffer;
+    AdvanceBy(buffer, buffer.GetCapacity() - 1);
+
+    ASSERT_TRUE(buffer.PushOne(1));
+    ASSERT_TRUE(buffer.PushOne(2));
+    EXPECT_EQ(buffer.Peek(), 1);
+    EXPECT_EQ(buffer.GetCurrentSize(), 2);
+
+    ASSERT_TRUE(buffer.Pop());
+    EXPECT_EQ(buffer.Peek(), 2);
+}
+
+TYPED_TEST(CircularBufferTest, KeepsOrderOverManyLaps)
+{
+    TypeParam buffer;
+    const std::size_t capacity = buffer.GetCapacity();
+    std::uint32_t pushed = 0;
+    std::uint32_t popped = 0;
+
+    // Batch sizes cycle through 1..capacity, so the indices wrap at every
+    // possible offset, over several laps of 2 * size
+    for (std::size_t round = 0; round < 8 * capacity; ++round) {
+        const std::size_t batch = round % capacity + 1;
+
+        for (std::size_t i = 0; i < batch; ++i) {
+            ASSERT_TRUE(buffer.PushOne(pushed++));
+        }
+
+        ASSERT_EQ(buffer.GetCurrentSize(), batch);
+
+        std::uint32_t out = 0;
+        for (std::size_t i = 0; i < batch; ++i) {
+            ASSERT_TRUE(buffer.PeekAndPop(out));
+            ASSERT_EQ(out, popped++);
+        }
+
+        ASSERT_TRUE(buffer.IsEmpty());
+    }
+}
+
+TYPED_TEST(CircularBufferTest, CopiesBlocksAcrossTheWrap)
+{
+    TypeParam buffer;
+    const std::size_t capacity = buffer.GetCapacity();
+    AdvanceBy(buffer, capacity - 1);
+
+    std::vector<std::uint32_t> input(capacity);
+    for (std::size_t i = 0; i < capacity; ++i) {
+        input[i] = static_cast<std::uint32_t>(100 + i);
+    }
+
+    ASSERT_EQ(buffer.PushMany(std::span<const std::uint32_t>(input)), capacity);
+
+    std::vector<std::uint32_t> peeked(capacity);
+    EXPECT_EQ(buffer.PeekMany(peeked.data(), capacity), capacity);
+    EXPECT_EQ(peeked, input);
+
+    const std::vector<std::uint32_t> iterated(buffer.begin(), buffer.end());
+    EXPECT_EQ(iterated, input);
+
+    std::vector<std::uint32_t> output(capacity + 1);
+    EXPECT_EQ(buffer.PopInto(output.data(), output.size()), capacity);
+    output.pop_back();
+    EXPECT_EQ(output, input);
+    EXPECT_TRUE(buffer.IsEmpty());
+}
+
+TYPED_TEST(CircularBufferTest, SplitsReadRegionsAtTheWrap)
+{
+    TypeParam buffer;
+    const std::size_t capacity = buffer.GetCapacity();
+
+    if (capacity < 2) {
+        GTEST_SKIP();
+    }
+
+    AdvanceBy(buffer, capacity - 1);
+
+    for (std::uint32_t i = 0; i < capacity; ++i) {
+        ASSERT_TRUE(buffer.PushOne(i));
+    }
+
+    const auto regions = buffer.AcquireReadRegions();
+    ASSERT_EQ(regions.GetSize(), capacity);
+    EXPECT_FALSE(regions.second.empty());
+
+    std::vector<std::uint32_t> contents(regions.first.begin(), regions.first.end());
+    contents.insert(contents.end(), regions.second.begin(), regions.second.end());
+
+    for (std::uint32_t i = 0; i < capacity; ++i) {
+        EXPECT_EQ(contents[i], i);
+    }
+
+    EXPECT_EQ(buffer.ReleaseRead(regions.first.size()), regions.first.size());
+    EXPECT_EQ(buffer.GetCurrentSize(), regions.second.size());
+    EXPECT_EQ(buffer.ReleaseRead(capacity), regions.second.size());
+    EXPECT_TRUE(buffer.IsEmpty());
+}
+
+TYPED_TEST(CircularBufferTest, CommitsWriteRegions)
+{
+    TypeParam buffer;
+    const std::size_t capacity = buffer.GetCapacity();
+    AdvanceBy(buffer, capacity / 2);
+
+    std::uint32_t next = 0;
+    std::size_t written = 0;
+
+    // The free space wraps, so it takes two regions
+    for (int part = 0; part < 2 && written < capacity; ++part) {
+        const std::span<std::uint32_t> region = buffer.AcquireWriteRegion();
+        ASSERT_FALSE(region.empty());
+
+        for (auto& element : region) {
+            element = next++;
+        }
+
+        written += buffer.CommitWrite(region.size());
+    }
+
+    EXPECT_EQ(written, capacity);
+    EXPECT_EQ(buffer.CommitWrite(1), 0);
+
+    std::uint32_t out = 0;
+    for (std::uint32_t i = 0; i < capacity; ++i) {
+        ASSERT_TRUE(buffer.PeekAndPop(out));
+        EXPECT_EQ(out, i);
+    }
+}
+
+TYPED_TEST(CircularBufferTest, ClearsFromAnyPosition)
+{
+    TypeParam buffer;
+    const std::size_t capacity = buffer.GetCapacity();
+    AdvanceBy(buffer, capacity - 1);
+
+    for (std::uint32_t i = 0; i < capacity; ++i) {
+        ASSERT_TRUE(buffer.PushOne(i));
+    }
+
+    buffer.Clear();
+    EXPECT_TRUE(buffer.IsEmpty());
+    EXPECT_TRUE(buffer.PushOne(7));
+    EXPECT_EQ(buffer.GetCurrentSize(), 1);
+}
+
+TEST(CircularBufferLifetimeTest, DestroysElementsExactlyOnce)
+{
+    {
+        CircularBuffer<Tracked, 4> buffer;
+
+        ASSERT_TRUE(buffer.Emplace(1));
+        ASSERT_TRUE(buffer.PushOne(Tracked(2)));
+        ASSERT_TRUE(buffer.PushOne(Tracked(3)));
+        EXPECT_EQ(Tracked::GetLiveCount(), 3);
+
+        Tracked out(0);
+        ASSERT_TRUE(buffer.PeekAndPop(out));
+        EXPECT_EQ(out.GetValue(), 1);
+        EXPECT_EQ(Tracked::GetLiveCount(), 3);
+
+        ASSERT_TRUE(buffer.Pop());
+        EXPECT_EQ(Tracked::GetLiveCount(), 2);
+
+        buffer.Clear();
+        EXPECT_EQ(Tracked::GetLiveCount(), 1);
+
+        ASSERT_TRUE(buffer.Emplace(4));
+        ASSERT_TRUE(buffer.Emplace(5));
+    }
+
+    EXPECT_EQ(Tracked::GetLiveCount(), 0);
+}
+
+TEST(CircularBufferLifetimeTest, MovesElementsBetweenBuffers)
+{
+    {
+        CircularBuffer<Tracked, 4> source;
+        CircularBuffer<Tracked, 2> target;
+
+        for (int i = 0; i < 3; ++i) {
+            ASSERT_TRUE(source.Emplace(i));
+        }
+
+        EXPECT_EQ(source.MoveTo(target), 2);
+        EXPECT_EQ(source.GetCurrentSize(), 1);
+        EXPECT_EQ(target.GetCurrentSize(), 2);
+        EXPECT_EQ(Tracked::GetLiveCount(), 3);
+
+        Tracked out(0);
+        ASSERT_TRUE(target.PeekAndPop(out));
+        EXPECT_EQ(out.GetValue(), 0);
+    }
+
+    EXPECT_EQ(Tracked::GetLiveCount(), 0);
+}
+
+using OverwritingBuffer = CircularBuffer<int, 4, NopMutexImpl,
+    OverflowPolicy::OverwriteOldest, CountingStatsImpl<>>;
+
+std::vector<int> Drain(OverwritingBuffer& buffer)
+{
+    std::vector<int> contents;
+    int out = 0;
+
+    while (buffer.PeekAndPop(out)) {
+        contents.push_back(out);
+    }
+
+    return contents;
+}
+
+TEST(CircularBufferOverwriteTest, DropsOldestElementsOneByOne)
+{
+    OverwritingBuffer buffer;
+
+    for (int i = 1; i <= 6; ++i) {
+        EXPECT_TRUE(buffer.PushOne(i));
+    }
+
+    EXPECT_EQ(buffer.GetCurrentSize(), 4);
+    EXPECT_EQ(buffer.GetStats().droppedElements, 2);
+    EXPECT_EQ(buffer.GetStats().rejectedPushes, 0);
+    EXPECT_EQ(Drain(buffer), (std::vector<int> { 3, 4, 5, 6 }));
+}
+
+TEST(CircularBufferOverwriteTest, KeepsTheLastElementsOfALongBlock)
+{
+    OverwritingBuffer buffer;
+    ASSERT_TRUE(buffer.PushOne(1));
+    ASSERT_TRUE(buffer.PushOne(2));
+    ASSERT_TRUE(buffer.PushOne(3));
+
+    const std::array<int, 10> block { 10, 11, 12, 13, 14, 15, 16, 17, 18, 19 };
+    std::size_t dropped = 0;
+
+    EXPECT_EQ(buffer.PushMany(std::span<const int>(block), dropped), block.size());
+    EXPECT_EQ(dropped, 3 + 6);
+    EXPECT_EQ(Drain(buffer), (std::vector<int> { 16, 17, 18, 19 }));
+}
+
+TEST(CircularBufferOverwriteTest, OverwritesPartOfTheBlock)
+{
+    OverwritingBuffer buffer;
+    ASSERT_TRUE(buffer.PushOne(1));
+    ASSERT_TRUE(buffer.PushOne(2));
+    ASSERT_TRUE(buffer.PushOne(3));
+
+    const std::array<int, 3> block { 4, 5, 6 };
+    std::size_t dropped = 0;
+
+    EXPECT_EQ(buffer.PushMany(std::span<const int>(block), dropped), block.size());
+    EXPECT_EQ(dropped, 2);
+    EXPECT_EQ(Drain(buffer), (std::vector<int> { 3, 4, 5, 6 }));
+}
+
+TEST(CircularBufferOverwriteTest, OverwritesFromNonContiguousRanges)
+{
+    OverwritingBuffer buffer;
+    const std::list<int> values { 1, 2, 3, 4, 5, 6, 7 };
+    std::size_t dropped = 0;
+
+    EXPECT_EQ(buffer.PushMany(values.begin(), values.end(), dropped), values.size());
+    EXPECT_EQ(dropped, 3);
+    EXPECT_EQ(Drain(buffer), (std::vector<int> { 4, 5, 6, 7 }));
+}
+
+TEST(CircularBufferOverwriteTest, DestroysOverwrittenElements)
+{
+    {
+        CircularBuffer<Tracked, 4, NopMutexImpl, OverflowPolicy::OverwriteOldest> buffer;
+
+        for (int i = 0; i < 10; ++i) {
+            ASSERT_TRUE(buffer.Emplace(i));
+        }
+
+        EXPECT_EQ(Tracked::GetLiveCount(), 4);
+
+        Tracked out(0);
+        ASSERT_TRUE(buffer.PeekAndPop(out));
+        EXPECT_EQ(out.GetValue(), 6);
+    }
+
+    EXPECT_EQ(Tracked::GetLiveCount(), 0);
+}
+
+TEST(CircularBufferStatsTest, CountsRejectedPushesAndEmptyPops)
+{
+    CircularBuffer<int, 2, NopMutexImpl, OverflowPolicy::Reject, CountingStatsImpl<>> buffer;
+
+    EXPECT_FALSE(buffer.Pop());
+    EXPECT_TRUE(buffer.PushOne(1));
+    EXPECT_TRUE(buffer.PushOne(2));
+    EXPECT_FALSE(buffer.PushOne(3));
+    EXPECT_TRUE(buffer.Pop());
+
+    const lg::CircularBufferStats stats = buffer.GetStats();
+    EXPECT_EQ(stats.highWaterMark, 2);
+    EXPECT_EQ(stats.pushedElements, 2);
+    EXPECT_EQ(stats.poppedElements, 1);
+    EXPECT_EQ(stats.rejectedPushes, 1);
+    EXPECT_EQ(stats.emptyPops, 1);
+}
+
+/**
+ * @brief Streams a counter from a producer thread to a consumer thread,
+ *        which checks that nothing is lost, duplicated or reordered
+ */
+template <typename Buffer>
+void StreamBetweenThreads()
+{
+    static constexpr std::uint32_t COUNT = 50000;
+    static constexpr std::size_t BLOCK = 7;
+
+    Buffer buffer;
+
+    std::thread producer([&buffer] {
+        std::array<std::uint32_t, BLOCK> block {};
+        std::uint32_t next = 0;
+
+        while (next < COUNT) {
+            const std::size_t count = std::min<std::size_t>(BLOCK, COUNT - next);
+            for (std::size_t i = 0; i < count; ++i) {
+                block[i] = next + static_cast<std::uint32_t>(i);
+            }
+
+            const std::size_t pushed
+                = buffer.PushMany(std::span<const std::uint32_t>(block.data(), count));
+
+            // Let the consumer run on a single core instead of spinning
+            if (pushed == 0) {
+                std::this_thread::yield();
+            }
+
+            next += static_cast<std::uint32_t>(pushed);
+        }
+    });
+
+    std::array<std::uint32_t, BLOCK> block {};
+    std::uint32_t expected = 0;
+    bool ordered = true;
+
+    while (expected < COUNT) {
+        const std::size_t count = buffer.PopInto(block.data(), block.size());
+
+        if (count == 0) {
+            std::this_thread::yield();
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            ordered = ordered && block[i] == expected;
+            ++expected;
+        }
+    }
+
+    producer.join();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(buffer.IsEmpty());
+}
+
+TEST(CircularBufferThreadTest, StreamsThroughCompactLayout)
+{
+    StreamBetweenThreads<CircularBuffer<std::uint32_t, 64>>();
+    StreamBetweenThreads<CircularBuffer<std::uint32_t, 100>>();
+}
+
+TEST(CircularBufferThreadTest, StreamsThroughPaddedLayout)
+{
+    StreamBetweenThreads<CircularBuffer<std::uint32_t, 64, NopMutexImpl,
+        OverflowPolicy::Reject, NopStatsImpl, 64>>();
+    StreamBetweenThreads<CircularBuffer<std::uint32_t, 100, NopMutexImpl,
+        OverflowPolicy::Reject, NopStatsImpl, 64>>();
+}
+
+}
@@ -0,0 +1,70 @@
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "leakguard/format.hpp"
+
+namespace {
+
+using lg::Format;
+using lg::FormatError;
+using lg::ParseFormat;
+using lg::StaticString;
+
+template <lg::FormatString format, typename... Args>
+using FormatResult = decltype(Format<format>(std::declval<const Args&>()...));
+
+// The capacity is the literal text plus the longest form of every argument
+static_assert(std::is_same_v<FormatResult<"id={}", int>, StaticString<3 + 11>>);
+static_assert(std::is_same_v<FormatResult<"{}", std::uint8_t>, StaticString<3>>);
+static_assert(std::is_same_v<FormatResult<"{x}", std::uint16_t>, StaticString<4>>);
+static_assert(std::is_same_v<FormatResult<"{x}", std::int64_t>, StaticString<16>>);
+static_assert(std::is_same_v<FormatResult<"{}{}", char, bool>, StaticString<1 + 5>>);
+static_assert(std::is_same_v<FormatResult<"[{}]", StaticString<8>>, StaticString<2 + 8>>);
+static_assert(std::is_same_v<FormatResult<"{}", char[6]>, StaticString<5>>);
+static_assert(std::is_same_v<FormatResult<"{{}}">, StaticString<2>>);
+static_assert(std::is_same_v<FormatResult<"">, StaticString<1>>);
+
+static_assert(ParseFormat<"{} {x}", 2>().error == FormatError::None);
+static_assert(ParseFormat<"{{ }}", 0>().error == FormatError::None);
+static_assert(ParseFormat<"{", 0>().error == FormatError::UnmatchedBrace);
+static_assert(ParseFormat<"a}b", 0>().error == FormatError::UnmatchedBrace);
+static_assert(ParseFormat<"{{}", 0>().error == FormatError::UnmatchedBrace);
+static_assert(ParseFormat<"{y}", 1>().error == FormatError::UnknownSpecifier);
+static_assert(ParseFormat<"{xx}", 1>().error == FormatError::UnknownSpecifier);
+
+TEST(FormatTest, FormatsEveryArgumentType)
+{
+    EXPECT_STREQ(Format<"id={} hex={x} ok={}">(42, 255, true).ToCStr(), "id=42 hex=ff ok=true");
+    EXPECT_STREQ(Format<"{}{}{}">('a', -7, false).ToCStr(), "a-7false");
+    EXPECT_STREQ(Format<"{} and {}">(StaticString<4>("ab"), "cd").ToCStr(), "ab and cd");
+    EXPECT_STREQ(Format<"{}/{}">(0.5, 1.25F).ToCStr(), "0.5/1.25");
+    EXPECT_STREQ(Format<"{x}">(std::int8_t { -1 }).ToCStr(), "ff");
+    EXPECT_STREQ(Format<"plain">().ToCStr(), "plain");
+}
+
+TEST(FormatTest, CollapsesEscapedBraces)
+{
+    EXPECT_STREQ(Format<"{{}}">().ToCStr(), "{}");
+    EXPECT_STREQ(Format<"{{{}}}">(7).ToCStr(), "{7}");
+    EXPECT_STREQ(Format<"{{x}} {x}">(10).ToCStr(), "{x} a");
+}
+
+TEST(FormatTest, FitsTheLongestValues)
+{
+    const auto minimum = Format<"{}">(std::numeric_limits<int>::min());
+    EXPECT_STREQ(minimum.ToCStr(), "-2147483648");
+    EXPECT_EQ(minimum.GetSize(), minimum.GetCapacity());
+
+    const auto hex = Format<"0x{x}">(std::numeric_limits<std::uint64_t>::max());
+    EXPECT_STREQ(hex.ToCStr(), "0xffffffffffffffff");
+    EXPECT_EQ(hex.GetSize(), hex.GetCapacity());
+
+    const auto flag = Format<"<{}>">(false);
+    EXPECT_EQ(flag.GetSize(), flag.GetCapacity());
+}
+
+}
@@ -0,0 +1,277 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+#include "leakguard/framing.hpp"
+
+namespace {
+
+using lg::CircularBuffer;
+using lg::FrameStatus;
+using lg::StaticString;
+
+using SmallBuffer = CircularBuffer<char, 8>;
+
+/**
+ * @brief Moves the read position of an empty buffer forward, so that
+ *        the next characters pushed wrap around after the first few
+ */
+template <typename Buffer>
+void Rotate(Buffer& buffer, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i) {
+        ASSERT_TRUE(buffer.PushOne('#'));
+        ASSERT_TRUE(buffer.Pop());
+    }
+}
+
+template <typename Buffer>
+void Push(Buffer& buffer, std::string_view characters)
+{
+    ASSERT_EQ(buffer.PushMany(characters.begin(), characters.end()), characters.size());
+}
+
+template <std::size_t maxSize>
+std::string ToString(const StaticString<maxSize>& string)
+{
+    return { string.begin(), string.end() };
+}
+
+TEST(FramingTest, FindsTheDelimiterInEitherRegion)
+{
+    const std::string message = "abcdefg";
+
+    // Every position of the delimiter, at every position of the wrap
+    for (std::size_t offset = 0; offset < 8; ++offset) {
+        for (std::size_t split = 0; split < message.size(); ++split) {
+            SmallBuffer buffer;
+            Rotate(buffer, offset);
+
+            std::string framed = message;
+            framed[split] = '\n';
+            Push(buffer, framed);
+
+            const lg::FrameRegions frame = lg::FindDelimitedFrame(buffer);
+            ASSERT_EQ(frame.status, FrameStatus::Complete);
+            EXPECT_EQ(frame.GetSize(), split) << offset << ' ' << split;
+            EXPECT_EQ(frame.consumed, split + 1);
+
+            StaticString<8> out;
+            ASSERT_EQ(lg::ExtractDelimitedFrame(buffer, out), FrameStatus::Complete);
+            EXPECT_EQ(ToString(out), message.substr(0, split)) << offset << ' ' << split;
+            EXPECT_EQ(buffer.GetCurrentSize(), message.size() - split - 1);
+        }
+    }
+}
+
+TEST(FramingTest, KeepsFramesInTheBufferUntilComplete)
+{
+    SmallBuffer buffer;
+    StaticString<8> out("stale");
+    Rotate(buffer, 5);
+
+    Push(buffer, "ab;c");
+    ASSERT_EQ(lg::ExtractDelimitedFrame(buffer, out, ';'), FrameStatus::Complete);
+    EXPECT_EQ(ToString(out), "ab");
+
+    EXPECT_EQ(lg::ExtractDelimitedFrame(buffer, out, ';'), FrameStatus::Incomplete);
+    EXPECT_TRUE(out.IsEmpty());
+    EXPECT_EQ(buffer.GetCurrentSize(), 1);
+
+    Push(buffer, "de;");
+    ASSERT_EQ(lg::ExtractDelimitedFrame(buffer, out, ';'), FrameStatus::Complete);
+    EXPECT_EQ(ToString(out), "cde");
+    EXPECT_TRUE(buffer.IsEmpty());
+}
+
+TEST(FramingTest, ExtractsLinesEndingWithCrLf)
+{
+    // The '\r' before, at and after the wrap
+    for (std::size_t offset = 0; offset < 8; ++offset) {
+        SmallBuffer buffer;
+        StaticString<8> out;
+        Rotate(buffer, offset);
+
+        Push(buffer, "abcd\r\n");
+        ASSERT_EQ(lg::ExtractLine(buffer, out), FrameStatus::Complete);
+        EXPECT_EQ(ToString(out), "abcd") << offset;
+
+        Push(buffer, "\r\n");
+        ASSERT_EQ(lg::ExtractLine(buffer, out), FrameStatus::Complete);
+        EXPECT_TRUE(out.IsEmpty()) << offset;
+
+        Push(buffer, "a\rb\n");
+        ASSERT_EQ(lg::ExtractLine(buffer, out), FrameStatus::Complete);
+        EXPECT_EQ(ToString(out), "a\rb") << offset;
+
+        Push(buffer, "xy\n\r\n");
+        ASSERT_EQ(lg::ExtractLine(buffer, out), FrameStatus::Complete);
+        EXPECT_EQ(ToString(out), "xy") << offset;
+        ASSERT_EQ(lg::ExtractLine(buffer, out), FrameStatus::Complete);
+        EXPECT_TRUE(out.IsEmpty()) << offset;
+        EXPECT_TRUE(buffer.IsEmpty());
+    }
+}
+
+TEST(FramingTest, SplitsLengthPrefixesAcrossTheWrap)
+{
+    for (std::size_t offset = 0; offset < 8; ++offset) {
+        SmallBuffer buffer;
+        StaticString<8> out;
+        Rotate(buffer, offset);
+
+        Push(buffer, std::string_view("\x03" "abc", 4));
+        ASSERT_EQ(lg::ExtractLengthPrefixedFrame(buffer, out), FrameStatus::Complete);
+        EXPECT_EQ(ToString(out), "abc") << offset;
+
+        Push(buffer, std::string_view("\x00\x05" "ab", 4));
+        EXPECT_EQ(lg::ExtractLengthPrefixedFrame<std::uint16_t>(buffer, out), FrameStatus::Incomplete);
+        EXPECT_EQ(buffer.GetCurrentSize(), 4);
+
+        Push(buffer, "cde");
+        ASSERT_EQ(lg::ExtractLengthPrefixedFrame<std::uint16_t>(buffer, out), FrameStatus::Complete);
+        EXPECT_EQ(ToString(out), "abcde") << offset;
+
+        Push(buffer, std::string_view("\x00", 1));
+        ASSERT_EQ(lg::ExtractLengthPrefixedFrame(buffer, out), FrameStatus::Complete);
+        EXPECT_TRUE(out.IsEmpty());
+        EXPECT_TRUE(buffer.IsEmpty());
+    }
+}
+
+TEST(FramingTest, ReadsMultiByteLengthsInNetworkOrder)
+{
+    CircularBuffer<char, 300> buffer;
+    StaticString<300> out;
+    Rotate(buffer, 299);
+
+    const std::string payload(0x104, 'x');
+    Push(buffer, std::string_view("\x01\x04", 2));
+    Push(buffer, payload);
+
+    ASSERT_EQ(lg::ExtractLengthPrefixedFrame<std::uint16_t>(buffer, out), FrameStatus::Complete);
+    EXPECT_EQ(ToString(out), payload);
+}
+
+TEST(FramingTest, DecodesCobsFrames)
+{
+    CircularBuffer<char, 600> buffer;
+    StaticString<300> out;
+
+    const auto extract = [&](std::string_view encoded) {
+        Push(buffer, encoded);
+        const FrameStatus status = lg::ExtractCobsFrame(buffer, out);
+        EXPECT_TRUE(buffer.IsEmpty());
+        return status;
+    };
+
+    // Start close to the end of the storage, so that frames wrap
+    Rotate(buffer, 595);
+
+    ASSERT_EQ(extract(std::string_view("\x01\x01\x00", 3)), FrameStatus::Complete);
+    EXPECT_EQ(ToString(out), std::string(1, '\0'));
+
+    ASSERT_EQ(extract(std::string_view("\x03\x11\x22\x02\x33\x00", 6)), FrameStatus::Complete);
+    EXPECT_EQ(ToString(out), std::string("\x11\x22\x00\x33", 4));
+
+    ASSERT_EQ(extract(std::string_view("\x05\x11\x22\x33\x44\x00", 6)), FrameStatus::Complete);
+    EXPECT_EQ(ToString(out), "\x11\x22\x33\x44");
+
+    // A full group of 254 characters, with and without a trailing group
+    std::string data;
+    for (int c = 1; c <= 254; ++c) {
+        data += static_cast<char>(c);
+    }
+
+    ASSERT_EQ(extract("\xFF" + data + std::string(1, '\0')), FrameStatus::Complete);
+    EXPECT_EQ(ToString(out), data);
+
+    ASSERT_EQ(extract("\xFF" + data + "\x02\xFF" + std::string(1, '\0')), FrameStatus::Complete);
+    EXPECT_EQ(ToString(out), data + "\xFF");
+
+    ASSERT_EQ(extract("\x01\xFF" + data + std::string(1, '\0')), FrameStatus::Complete);
+    EXPECT_EQ(ToString(out), std::string(1, '\0') + data);
+}
+
+TEST(FramingTest, DropsMalformedCobsFrames)
+{
+    SmallBuffer buffer;
+    StaticString<8> out;
+    Rotate(buffer, 6);
+
+    Push(buffer, std::string_view("\x00", 1));
+    EXPECT_EQ(lg::ExtractCobsFrame(buffer, out), FrameStatus::Malformed);
+    EXPECT_TRUE(buffer.IsEmpty());
+
+    Push(buffer, std::string_view("\x05\x11\x00", 3));
+    EXPECT_EQ(lg::ExtractCobsFrame(buffer, out), FrameStatus::Malformed);
+    EXPECT_TRUE(out.IsEmpty());
+    EXPECT_TRUE(buffer.IsEmpty());
+
+    Push(buffer, std::string_view("\x02\x11\x00", 3));
+    ASSERT_EQ(lg::ExtractCobsFrame(buffer, out), FrameStatus::Complete);
+    EXPECT_EQ(ToString(out), "\x11");
+}
+
+TEST(FramingTest, DropsFramesLongerThanTheString)
+{
+    SmallBuffer buffer;
+    StaticString<3> out;
+    Rotate(buffer, 4);
+
+    Push(buffer, "abcd\nef\n");
+    EXPECT_EQ(lg::ExtractDelimitedFrame(buffer, out), FrameStatus::TooLong);
+    EXPECT_TRUE(out.IsEmpty());
+    ASSERT_EQ(lg::ExtractDelimitedFrame(buffer, out), FrameStatus::Complete);
+    EXPECT_EQ(ToString(out), "ef");
+
+    Push(buffer, std::string_view("\x04wxyz", 5));
+    EXPECT_EQ(lg::ExtractLengthPrefixedFrame(buffer, out), FrameStatus::TooLong);
+    EXPECT_TRUE(buffer.IsEmpty());
+
+    Push(buffer, std::string_view("\x05\x11\x22\x33\x44\x00", 6));
+    EXPECT_EQ(lg::ExtractCobsFrame(buffer, out), FrameStatus::TooLong);
+    EXPECT_TRUE(out.IsEmpty());
+    EXPECT_TRUE(buffer.IsEmpty());
+
+    // Exactly the string capacity, with a zero decoded in
+    Push(buffer, std::string_view("\x02\x11\x02\x22\x00", 5));
+    ASSERT_EQ(lg::ExtractCobsFrame(buffer, out), FrameStatus::Complete);
+    EXPECT_EQ(ToString(out), std::string("\x11\x00\x22", 3));
+}
+
+TEST(FramingTest, DropsAFullBufferWithoutAFrame)
+{
+    SmallBuffer buffer;
+    StaticString<8> out;
+    Rotate(buffer, 3);
+
+    Push(buffer, "abcdefg");
+    EXPECT_EQ(lg::ExtractLine(buffer, out), FrameStatus::Incomplete);
+    EXPECT_EQ(buffer.GetCurrentSize(), 7);
+
+    Push(buffer, "h");
+    EXPECT_EQ(lg::ExtractLine(buffer, out), FrameStatus::TooLong);
+    EXPECT_TRUE(buffer.IsEmpty());
+
+    // The rest of the dropped line arrives as a line of its own
+    Push(buffer, "ij\nkl\n");
+    ASSERT_EQ(lg::ExtractLine(buffer, out), FrameStatus::Complete);
+    EXPECT_EQ(ToString(out), "ij");
+    ASSERT_EQ(lg::ExtractLine(buffer, out), FrameStatus::Complete);
+    EXPECT_EQ(ToString(out), "kl");
+
+    // A length that can never fit in the buffer
+    Push(buffer, std::string_view("\x10" "abcdefg", 8));
+    EXPECT_EQ(lg::ExtractLengthPrefixedFrame(buffer, out), FrameStatus::TooLong);
+    EXPECT_TRUE(buffer.IsEmpty());
+
+    Push(buffer, "\x03" "abcdefg");
+    EXPECT_EQ(lg::ExtractCobsFrame(buffer, out), FrameStatus::TooLong);
+    EXPECT_TRUE(buffer.IsEmpty());
+}
+
+}
@@ -0,0 +1,98 @@
+#include <array>
+#include <cstddef>
+#include <set>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "leakguard/hash.hpp"
+
+namespace {
+
+using lg::Hash;
+using lg::HashedStaticString;
+using lg::StaticStringView;
+
+// Longer than three words, so that every tail length is hashed
+constexpr const char* TEXT = "the quick brown fox jumps over it";
+constexpr std::size_t TEXT_LENGTH = 33;
+
+consteval std::array<std::size_t, TEXT_LENGTH + 1> HashPrefixes()
+{
+    std::array<std::size_t, TEXT_LENGTH + 1> hashes {};
+    for (std::size_t length = 0; length <= TEXT_LENGTH; ++length) {
+        hashes[length] = Hash(StaticStringView(TEXT, length));
+    }
+
+    return hashes;
+}
+
+enum class Command { Reset, Run, Stop, Unknown };
+
+Command ParseCommand(StaticStringView command)
+{
+    switch (Hash(command)) {
+    case Hash(lg::STR("reset")):
+        return Command::Reset;
+    case Hash(lg::STR("run")):
+        return Command::Run;
+    case Hash(lg::STR("stop")):
+        return Command::Stop;
+    default:
+        return Command::Unknown;
+    }
+}
+
+TEST(HashTest, MatchesTheCompileTimeHash)
+{
+    static constexpr auto EXPECTED = HashPrefixes();
+    const std::string text = TEXT;
+    std::set<std::size_t> distinct;
+
+    for (std::size_t length = 0; length <= TEXT_LENGTH; ++length) {
+        const std::size_t hash = Hash(StaticStringView(text.data(), length));
+        EXPECT_EQ(hash, EXPECTED[length]) << length;
+        distinct.insert(hash);
+    }
+
+    EXPECT_EQ(distinct.size(), TEXT_LENGTH + 1);
+}
+
+TEST(HashTest, SwitchesOnHashedLiterals)
+{
+    const std::string reset = "reset";
+
+    EXPECT_EQ(ParseCommand(StaticStringView(reset)), Command::Reset);
+    EXPECT_EQ(ParseCommand("run"), Command::Run);
+    EXPECT_EQ(ParseCommand(lg::STR("stop")), Command::Stop);
+    EXPECT_EQ(ParseCommand("resets"), Command::Unknown);
+    EXPECT_EQ(ParseCommand(""), Command::Unknown);
+}
+
+TEST(HashedStaticStringTest, CachesTheHash)
+{
+    static_assert(HashedStaticString<8>("abc").GetHash() == Hash("abc"));
+
+    const std::string text = "abc";
+    const HashedStaticString<8> hashed { StaticStringView(text) };
+    EXPECT_EQ(hashed.GetHash(), Hash("abc"));
+    EXPECT_EQ(hashed.GetView(), StaticStringView("abc"));
+
+    // The hash covers the stored characters only
+    const HashedStaticString<2> truncated("abc");
+    EXPECT_EQ(truncated.GetHash(), Hash("ab"));
+}
+
+TEST(HashedStaticStringTest, ComparesAcrossCapacities)
+{
+    const HashedStaticString<8> abc("abc");
+
+    EXPECT_TRUE(abc == HashedStaticString<16>("abc"));
+    EXPECT_FALSE(abc != HashedStaticString<16>("abc"));
+    EXPECT_TRUE(abc != HashedStaticString<8>("abd"));
+    EXPECT_TRUE(abc != HashedStaticString<8>("ab"));
+    EXPECT_TRUE(abc != HashedStaticString<8>());
+    EXPECT_TRUE(HashedStaticString<4>() == HashedStaticString<8>(""));
+}
+
+}
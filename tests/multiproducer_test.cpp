@@ -0,0 +1,257 @@
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "leakguard/circularbuffer.hpp"
+#include "tracked.hpp"
+
+namespace {
+
+using lg::MpmcRingBuffer;
+using lg::MpscRingBuffer;
+using lg::test::Tracked;
+
+template <typename Buffer>
+class MultiProducerTest : public testing::Test { };
+
+using Buffers = testing::Types<
+    MpmcRingBuffer<std::uint32_t, 2>,
+    MpmcRingBuffer<std::uint32_t, 8>,
+    MpscRingBuffer<std::uint32_t, 8>>;
+
+TYPED_TEST_SUITE(MultiProducerTest, Buffers);
+
+TYPED_TEST(MultiProducerTest, StartsEmpty)
+{
+    TypeParam buffer;
+    std::uint32_t out = 42;
+
+    EXPECT_TRUE(buffer.IsEmpty());
+    EXPECT_EQ(buffer.GetCurrentSize(), 0);
+    EXPECT_FALSE(buffer.Pop());
+    EXPECT_FALSE(buffer.PeekAndPop(out));
+    EXPECT_EQ(out, 42);
+}
+
+TYPED_TEST(MultiProducerTest, RejectsPushesWhenFull)
+{
+    TypeParam buffer;
+    const std::size_t capacity = buffer.GetCapacity();
+
+    for (std::uint32_t i = 0; i < capacity; ++i) {
+        ASSERT_TRUE(buffer.PushOne(i));
+    }
+
+    EXPECT_EQ(buffer.GetCurrentSize(), capacity);
+    EXPECT_FALSE(buffer.PushOne(99));
+
+    const std::array<std::uint32_t, 2> more { 1, 2 };
+    EXPECT_EQ(buffer.PushMany(more.begin(), more.end()), 0);
+
+    ASSERT_TRUE(buffer.Pop());
+    EXPECT_EQ(buffer.PushMany(more.begin(), more.end()), 1);
+
+    std::uint32_t out = 0;
+    for (std::uint32_t i = 1; i < capacity; ++i) {
+        ASSERT_TRUE(buffer.PeekAndPop(out));
+        EXPECT_EQ(out, i);
+    }
+
+    ASSERT_TRUE(buffer.PeekAndPop(out));
+    EXPECT_EQ(out, 1);
+    EXPECT_TRUE(buffer.IsEmpty());
+}
+
+TYPED_TEST(MultiProducerTest, KeepsOrderOverManyLaps)
+{
+    TypeParam buffer;
+    const std::size_t capacity = buffer.GetCapacity();
+    std::uint32_t pushed = 0;
+    std::uint32_t popped = 0;
+
+    for (std::size_t round = 0; round < 8 * capacity; ++round) {
+        const std::size_t batch = round % capacity + 1;
+
+        for (std::size_t i = 0; i < batch; ++i) {
+            ASSERT_TRUE(buffer.PushOne(pushed++));
+        }
+
+        std::uint32_t out = 0;
+        for (std::size_t i = 0; i < batch; ++i) {
+            ASSERT_TRUE(buffer.PeekAndPop(out));
+            ASSERT_EQ(out, popped++);
+        }
+
+        ASSERT_TRUE(buffer.IsEmpty());
+    }
+}
+
+TEST(MultiProducerLifetimeTest, DestroysElementsExactlyOnce)
+{
+    {
+        MpmcRingBuffer<Tracked, 4> buffer;
+        Tracked out(0);
+
+        for (int lap = 0; lap < 3; ++lap) {
+            for (int i = 0; i < 4; ++i) {
+                ASSERT_TRUE(buffer.PushOne(Tracked(i)));
+            }
+
+            EXPECT_EQ(Tracked::GetLiveCount(), 5);
+            EXPECT_FALSE(buffer.PushOne(Tracked(4)));
+
+            ASSERT_TRUE(buffer.PeekAndPop(out));
+            EXPECT_EQ(out.GetValue(), 0);
+            ASSERT_TRUE(buffer.Pop());
+            EXPECT_EQ(Tracked::GetLiveCount(), 3);
+
+            ASSERT_TRUE(buffer.PeekAndPop(out));
+            EXPECT_EQ(out.GetValue(), 2);
+            ASSERT_TRUE(buffer.Pop());
+            EXPECT_EQ(Tracked::GetLiveCount(), 1);
+        }
+
+        // The elements left in the buffer are destroyed along with it
+        ASSERT_TRUE(buffer.PushOne(Tracked(5)));
+        ASSERT_TRUE(buffer.PushOne(Tracked(6)));
+        EXPECT_EQ(Tracked::GetLiveCount(), 3);
+    }
+
+    EXPECT_EQ(Tracked::GetLiveCount(), 0);
+}
+
+constexpr std::uint32_t PRODUCERS = 4;
+constexpr std::uint32_t PER_PRODUCER = 20000;
+
+/**
+ * @brief Tags a value with the index of the producer pushing it
+ */
+constexpr std::uint32_t Tag(std::uint32_t producer, std::uint32_t sequence)
+{
+    return producer << 24 | sequence;
+}
+
+template <typename Buffer>
+std::vector<std::thread> StartProducers(Buffer& buffer)
+{
+    std::vector<std::thread> producers;
+
+    for (std::uint32_t producer = 0; producer < PRODUCERS; ++producer) {
+        producers.emplace_back([&buffer, producer] {
+            for (std::uint32_t i = 0; i < PER_PRODUCER;) {
+                if (buffer.PushOne(Tag(producer, i))) {
+                    ++i;
+                } else {
+                    // Let the consumers run on a single core instead of spinning
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    return producers;
+}
+
+TEST(MultiProducerThreadTest, SingleConsumerSeesEachProducerInOrder)
+{
+    static MpscRingBuffer<std::uint32_t, 64> buffer;
+    std::vector<std::thread> producers = StartProducers(buffer);
+
+    std::array<std::uint32_t, PRODUCERS> next {};
+    bool ordered = true;
+
+    for (std::uint32_t received = 0; received < PRODUCERS * PER_PRODUCER;) {
+        std::uint32_t value = 0;
+
+        if (buffer.PeekAndPop(value)) {
+            const std::uint32_t producer = value >> 24;
+            ordered = ordered && producer < PRODUCERS
+                && (value & 0xFFFFFF) == next[producer];
+
+            if (producer < PRODUCERS) {
+                ++next[producer];
+            }
+
+            ++received;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(buffer.IsEmpty());
+}
+
+TEST(MultiProducerThreadTest, ConsumersShareTheElementsExactlyOnce)
+{
+    static constexpr std::uint32_t CONSUMERS = 3;
+    static MpmcRingBuffer<std::uint32_t, 64> buffer;
+
+    std::vector<std::thread> producers = StartProducers(buffer);
+    std::atomic<std::uint32_t> received { 0 };
+    std::array<std::vector<std::uint32_t>, CONSUMERS> values;
+    std::vector<std::thread> consumers;
+
+    for (std::uint32_t consumer = 0; consumer < CONSUMERS; ++consumer) {
+        consumers.emplace_back([&, consumer] {
+            while (received.load(std::memory_order_relaxed) < PRODUCERS * PER_PRODUCER) {
+                std::uint32_t value = 0;
+
+                if (buffer.PeekAndPop(value)) {
+                    values[consumer].push_back(value);
+                    received.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& thread : producers) {
+        thread.join();
+    }
+
+    for (auto& thread : consumers) {
+        thread.join();
+    }
+
+    // Every value arrives once, and each consumer sees every producer in order
+    std::vector<bool> seen(PRODUCERS * PER_PRODUCER);
+    bool unique = true;
+    bool ordered = true;
+
+    for (const auto& consumed : values) {
+        std::array<std::int64_t, PRODUCERS> last;
+        last.fill(-1);
+
+        for (const std::uint32_t value : consumed) {
+            const std::uint32_t producer = value >> 24;
+            const std::uint32_t sequence = value & 0xFFFFFF;
+            ASSERT_LT(producer, PRODUCERS);
+            ASSERT_LT(sequence, PER_PRODUCER);
+
+            const std::size_t index = producer * PER_PRODUCER + sequence;
+            unique = unique && !seen[index];
+            seen[index] = true;
+
+            ordered = ordered && sequence > last[producer];
+            last[producer] = sequence;
+        }
+    }
+
+    EXPECT_EQ(received.load(), PRODUCERS * PER_PRODUCER);
+    EXPECT_TRUE(unique);
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(buffer.IsEmpty());
+}
+
+}
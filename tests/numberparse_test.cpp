@@ -0,0 +1,102 @@
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <system_error>
+
+#include <gtest/gtest.h>
+
+#include "leakguard/numberparse.hpp"
+#include "leakguard/staticstring.hpp"
+
+namespace {
+
+using lg::StaticString;
+
+template <typename T>
+lg::ParseResult<T> ParseInteger(const std::string& text, unsigned base = 10)
+{
+    return lg::ParseInteger<T>(text.data(), text.size(), base);
+}
+
+TEST(ParseIntegerTest, ParsesTheFullRange)
+{
+    EXPECT_EQ(ParseInteger<std::int8_t>("127").value, 127);
+    EXPECT_EQ(ParseInteger<std::int8_t>("-128").value, -128);
+    EXPECT_EQ(ParseInteger<std::uint8_t>("255").value, 255);
+    EXPECT_EQ(ParseInteger<std::int32_t>("-2147483648").value, std::numeric_limits<std::int32_t>::min());
+    EXPECT_EQ(ParseInteger<std::uint32_t>("4294967295").value, std::numeric_limits<std::uint32_t>::max());
+    EXPECT_EQ(ParseInteger<std::int64_t>("-9223372036854775808").value,
+        std::numeric_limits<std::int64_t>::min());
+    EXPECT_EQ(ParseInteger<std::uint64_t>("18446744073709551615").value,
+        std::numeric_limits<std::uint64_t>::max());
+    EXPECT_EQ(ParseInteger<std::uint64_t>("0000000000000000000000001").value, 1);
+}
+
+TEST(ParseIntegerTest, ReportsOverflow)
+{
+    for (const char* text : { "128", "-129", "1000" }) {
+        EXPECT_EQ(ParseInteger<std::int8_t>(text).error, std::errc::result_out_of_range) << text;
+    }
+
+    EXPECT_EQ(ParseInteger<std::uint8_t>("256").error, std::errc::result_out_of_range);
+    EXPECT_EQ(ParseInteger<std::int32_t>("2147483648").error, std::errc::result_out_of_range);
+    EXPECT_EQ(ParseInteger<std::int32_t>("-2147483649").error, std::errc::result_out_of_range);
+    EXPECT_EQ(ParseInteger<std::uint32_t>("4294967296").error, std::errc::result_out_of_range);
+    EXPECT_EQ(ParseInteger<std::uint64_t>("18446744073709551616").error,
+        std::errc::result_out_of_range);
+
+    // Overflow inside an 8-digit chunk and after the chunks
+    EXPECT_EQ(ParseInteger<std::uint32_t>("99999999999").error, std::errc::result_out_of_range);
+    EXPECT_EQ(ParseInteger<std::uint64_t>("1234567812345678123456781").error,
+        std::errc::result_out_of_range);
+
+    const auto result = ParseInteger<std::int8_t>("300");
+    EXPECT_FALSE(result);
+    EXPECT_EQ(result.value, 0);
+}
+
+TEST(ParseIntegerTest, RejectsTrailingAndInvalidCharacters)
+{
+    for (const char* text : { "", "-", "12a", "1 ", " 1", "+1", "1-", "--1", "0x10", "1234567a", "123456789a" }) {
+        EXPECT_EQ(ParseInteger<std::int32_t>(text).error, std::errc::invalid_argument) << '"' << text << '"';
+    }
+
+    // A trailing character after an overflow is still an invalid number
+    EXPECT_EQ(ParseInteger<std::uint32_t>("99999999999x").error, std::errc::invalid_argument);
+    EXPECT_EQ(ParseInteger<std::uint32_t>("-1").error, std::errc::invalid_argument);
+}
+
+TEST(ParseIntegerTest, ParsesOtherBases)
+{
+    EXPECT_EQ(ParseInteger<std::uint8_t>("ff", 16).value, 255);
+    EXPECT_EQ(ParseInteger<std::uint8_t>("FF", 16).value, 255);
+    EXPECT_EQ(ParseInteger<std::uint8_t>("100", 16).error, std::errc::result_out_of_range);
+    EXPECT_EQ(ParseInteger<std::int32_t>("-101", 2).value, -5);
+    EXPECT_EQ(ParseInteger<std::int32_t>("2", 2).error, std::errc::invalid_argument);
+    EXPECT_EQ(ParseInteger<std::int32_t>("zz", 36).value, 35 * 36 + 35);
+    EXPECT_EQ(ParseInteger<std::int32_t>("1", 1).error, std::errc::invalid_argument);
+    EXPECT_EQ(ParseInteger<std::int32_t>("1", 37).error, std::errc::invalid_argument);
+}
+
+TEST(StaticStringParseTest, ParsesTheWholeString)
+{
+    EXPECT_EQ(StaticString<16>("-1234567890").Parse<std::int32_t>().value, -1234567890);
+    EXPECT_EQ(StaticString<16>("7f").Parse<std::uint8_t>(16).value, 127);
+    EXPECT_EQ(StaticString<16>("12 ").Parse<int>().error, std::errc::invalid_argument);
+    EXPECT_EQ(StaticString<16>("4294967296").Parse<std::uint32_t>().error,
+        std::errc::result_out_of_range);
+    EXPECT_EQ(StaticString<16>("").Parse<int>().error, std::errc::invalid_argument);
+}
+
+TEST(StaticStringParseTest, ParsesFloats)
+{
+    EXPECT_DOUBLE_EQ(StaticString<16>("-1.5e3").ParseFloat<double>().value, -1500.0);
+    EXPECT_FLOAT_EQ(StaticString<16>("0.25").ParseFloat<float>().value, 0.25F);
+    EXPECT_EQ(StaticString<16>("1.5x").ParseFloat<double>().error, std::errc::invalid_argument);
+    EXPECT_EQ(StaticString<16>("x").ParseFloat<double>().error, std::errc::invalid_argument);
+    EXPECT_EQ(StaticString<16>("1e999").ParseFloat<double>().error, std::errc::result_out_of_range);
+    EXPECT_EQ(StaticString<16>("1.5e3").ParseFloat<double>(std::chars_format::fixed).error,
+        std::errc::invalid_argument);
+}
+
+}
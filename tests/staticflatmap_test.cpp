@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "leakguard/staticflatmap.hpp"
+
+namespace {
+
+using lg::StaticFlatMap;
+using lg::StaticFlatSet;
+
+template <typename Map>
+std::vector<int> KeysOf(const Map& map)
+{
+    return { map.GetKeys().begin(), map.GetKeys().end() };
+}
+
+TEST(StaticFlatMapTest, KeepsKeysSorted)
+{
+    StaticFlatMap<int, char, 8> map;
+
+    for (const int key : { 5, 1, 4, 2, 3 }) {
+        ASSERT_TRUE(map.InsertOrAssign(key, static_cast<char>('a' + key)));
+    }
+
+    EXPECT_EQ(KeysOf(map), (std::vector<int> { 1, 2, 3, 4, 5 }));
+    EXPECT_EQ(map.GetValues()[0], 'b');
+    EXPECT_EQ(*map.Find(4), 'e');
+    EXPECT_EQ(map.Find(6), nullptr);
+}
+
+TEST(StaticFlatMapTest, AssignsDuplicateKeys)
+{
+    StaticFlatMap<int, char, 2> map;
+
+    EXPECT_TRUE(map.InsertOrAssign(1, 'a'));
+    EXPECT_TRUE(map.InsertOrAssign(2, 'b'));
+    EXPECT_TRUE(map.InsertOrAssign(1, 'c'));
+    EXPECT_FALSE(map.InsertOrAssign(3, 'd'));
+
+    EXPECT_EQ(map.GetSize(), 2);
+    EXPECT_EQ(*map.Find(1), 'c');
+}
+
+TEST(StaticFlatMapTest, BuildsWithTheLastDuplicateWinning)
+{
+    StaticFlatMap<int, char, 8> map;
+    const std::array<std::pair<int, char>, 7> pairs { {
+        { 3, 'a' }, { 1, 'b' }, { 3, 'c' }, { 2, 'd' }, { 1, 'e' }, { 3, 'f' }, { 0, 'g' },
+    } };
+
+    EXPECT_EQ(map.BuildFrom(pairs.begin(), pairs.end()), 4);
+    EXPECT_EQ(KeysOf(map), (std::vector<int> { 0, 1, 2, 3 }));
+    EXPECT_EQ(*map.Find(0), 'g');
+    EXPECT_EQ(*map.Find(1), 'e');
+    EXPECT_EQ(*map.Find(2), 'd');
+    EXPECT_EQ(*map.Find(3), 'f');
+}
+
+TEST(StaticFlatMapTest, BuildsTheSameMapAsInsertOrAssign)
+{
+    const std::array<std::pair<int, int>, 9> pairs { {
+        { 7, 0 }, { 7, 1 }, { 2, 2 }, { 9, 3 }, { 2, 4 }, { 7, 5 }, { 1, 6 }, { 9, 7 }, { 4, 8 },
+    } };
+
+    StaticFlatMap<int, int, 16> built;
+    built.BuildFrom(pairs.begin(), pairs.end());
+
+    StaticFlatMap<int, int, 16> inserted;
+    for (const auto& [key, value] : pairs) {
+        inserted.InsertOrAssign(key, value);
+    }
+
+    EXPECT_EQ(KeysOf(built), KeysOf(inserted));
+    EXPECT_TRUE(std::ranges::equal(built.GetValues(), inserted.GetValues()));
+
+    // Duplicates past the capacity still update their keys
+    StaticFlatMap<int, int, 3> builtFull;
+    EXPECT_EQ(builtFull.BuildFrom(pairs.begin(), pairs.end()), 3);
+
+    StaticFlatMap<int, int, 3> insertedFull;
+    for (const auto& [key, value] : pairs) {
+        insertedFull.InsertOrAssign(key, value);
+    }
+
+    EXPECT_EQ(KeysOf(builtFull), (std::vector<int> { 2, 7, 9 }));
+    EXPECT_EQ(KeysOf(builtFull), KeysOf(insertedFull));
+    EXPECT_TRUE(std::ranges::equal(builtFull.GetValues(), insertedFull.GetValues()));
+}
+
+TEST(StaticFlatMapTest, ErasesKeys)
+{
+    StaticFlatMap<int, char, 4> map;
+    map.InsertOrAssign(1, 'a');
+    map.InsertOrAssign(2, 'b');
+    map.InsertOrAssign(3, 'c');
+
+    EXPECT_TRUE(map.Erase(2));
+    EXPECT_FALSE(map.Erase(2));
+    EXPECT_EQ(KeysOf(map), (std::vector<int> { 1, 3 }));
+    EXPECT_EQ(*map.Find(3), 'c');
+}
+
+TEST(StaticFlatMapTest, UsesTheProvidedOrder)
+{
+    StaticFlatMap<int, int, 4, std::greater<int>> map;
+    map.InsertOrAssign(1, 1);
+    map.InsertOrAssign(3, 3);
+    map.InsertOrAssign(2, 2);
+
+    EXPECT_EQ(KeysOf(map), (std::vector<int> { 3, 2, 1 }));
+    EXPECT_EQ(*map.Find(2), 2);
+}
+
+TEST(StaticFlatSetTest, StoresDuplicatesOnce)
+{
+    StaticFlatSet<int, 3> set;
+
+    EXPECT_TRUE(set.Insert(2));
+    EXPECT_TRUE(set.Insert(1));
+    EXPECT_TRUE(set.Insert(2));
+    EXPECT_TRUE(set.Insert(3));
+    EXPECT_FALSE(set.Insert(4));
+    EXPECT_TRUE(set.Insert(3));
+
+    EXPECT_EQ(set.GetSize(), 3);
+    EXPECT_EQ(std::vector<int>(set.begin(), set.end()), (std::vector<int> { 1, 2, 3 }));
+}
+
+TEST(StaticFlatSetTest, BuildsWithoutDuplicates)
+{
+    StaticFlatSet<int, 8> set;
+    const std::array<int, 8> keys { 5, 3, 5, 1, 3, 3, 8, 1 };
+
+    EXPECT_EQ(set.BuildFrom(keys.begin(), keys.end()), 4);
+    EXPECT_EQ(std::vector<int>(set.begin(), set.end()), (std::vector<int> { 1, 3, 5, 8 }));
+
+    // Duplicates do not take up room needed by later keys
+    StaticFlatSet<int, 3> full;
+    EXPECT_EQ(full.BuildFrom(keys.begin(), keys.end()), 3);
+    EXPECT_EQ(std::vector<int>(full.begin(), full.end()), (std::vector<int> { 1, 3, 5 }));
+    EXPECT_TRUE(set.Contains(8));
+    EXPECT_FALSE(set.Contains(2));
+
+    EXPECT_TRUE(set.Erase(3));
+    EXPECT_FALSE(set.Erase(3));
+    EXPECT_EQ(std::vector<int>(set.begin(), set.end()), (std::vector<int> { 1, 5, 8 }));
+}
+
+}
@@ -0,0 +1,180 @@
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include "leakguard/statichashmap.hpp"
+#include "tracked.hpp"
+
+namespace {
+
+using lg::StaticHashMap;
+using lg::test::Tracked;
+
+/**
+ * @brief Sends every key to the same bucket, so that all entries form
+ *        a single probe sequence
+ */
+struct CollidingHash {
+    std::size_t operator()(int) const noexcept
+    {
+        return 0;
+    }
+};
+
+/**
+ * @brief Sends keys to one of a few buckets, so that probe sequences
+ *        overlap and entries get displaced by other keys
+ */
+struct ClusteringHash {
+    std::size_t operator()(int key) const noexcept
+    {
+        return static_cast<std::size_t>(key % 3);
+    }
+};
+
+TEST(StaticHashMapTest, StartsEmpty)
+{
+    StaticHashMap<int, int, 8> map;
+
+    EXPECT_TRUE(map.IsEmpty());
+    EXPECT_EQ(map.GetSize(), 0);
+    EXPECT_EQ(map.Find(1), nullptr);
+    EXPECT_FALSE(map.Contains(1));
+    EXPECT_FALSE(map.Erase(1));
+}
+
+TEST(StaticHashMapTest, AssignsExistingKeys)
+{
+    StaticHashMap<int, int, 8> map;
+
+    EXPECT_TRUE(map.InsertOrAssign(1, 10));
+    EXPECT_TRUE(map.InsertOrAssign(1, 11));
+    EXPECT_EQ(map.GetSize(), 1);
+    ASSERT_NE(map.Find(1), nullptr);
+    EXPECT_EQ(*map.Find(1), 11);
+}
+
+TEST(StaticHashMapTest, RejectsNewKeysWhenFull)
+{
+    StaticHashMap<int, int, 4> map;
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(map.InsertOrAssign(i, i));
+    }
+
+    EXPECT_FALSE(map.InsertOrAssign(4, 4));
+    EXPECT_TRUE(map.InsertOrAssign(3, 30));
+    EXPECT_EQ(map.GetSize(), 4);
+    EXPECT_EQ(*map.Find(3), 30);
+}
+
+TEST(StaticHashMapTest, ShiftsCollidingEntriesBackOnErase)
+{
+    StaticHashMap<int, int, 6, CollidingHash> map;
+
+    for (int i = 0; i < 6; ++i) {
+        ASSERT_TRUE(map.InsertOrAssign(i, i * 10));
+    }
+
+    // Erasing from the middle of the probe sequence must keep the entries
+    // behind it reachable
+    EXPECT_TRUE(map.Erase(2));
+    EXPECT_FALSE(map.Contains(2));
+
+    for (int i : { 0, 1, 3, 4, 5 }) {
+        ASSERT_NE(map.Find(i), nullptr) << i;
+        EXPECT_EQ(*map.Find(i), i * 10);
+    }
+
+    // The first and the last entry of the sequence
+    EXPECT_TRUE(map.Erase(0));
+    EXPECT_TRUE(map.Erase(5));
+    EXPECT_EQ(map.GetSize(), 3);
+
+    for (int i : { 1, 3, 4 }) {
+        ASSERT_NE(map.Find(i), nullptr) << i;
+        EXPECT_EQ(*map.Find(i), i * 10);
+    }
+
+    EXPECT_TRUE(map.InsertOrAssign(2, 21));
+    EXPECT_EQ(*map.Find(2), 21);
+
+    for (int i : { 1, 2, 3, 4 }) {
+        EXPECT_TRUE(map.Erase(i));
+    }
+
+    EXPECT_TRUE(map.IsEmpty());
+}
+
+TEST(StaticHashMapTest, MatchesStdUnorderedMap)
+{
+    StaticHashMap<int, int, 32, ClusteringHash> map;
+    std::unordered_map<int, int> expected;
+    std::mt19937 random(1234);
+
+    for (int step = 0; step < 20000; ++step) {
+        const int key = static_cast<int>(random() % 48);
+
+        if (random() % 2 == 0) {
+            const int value = static_cast<int>(random() % 1000);
+            const bool fits = expected.size() < 32 || expected.contains(key);
+
+            ASSERT_EQ(map.InsertOrAssign(key, value), fits);
+            if (fits) {
+                expected[key] = value;
+            }
+        } else {
+            ASSERT_EQ(map.Erase(key), expected.erase(key) == 1);
+        }
+
+        ASSERT_EQ(map.GetSize(), expected.size());
+    }
+
+    for (int key = 0; key < 48; ++key) {
+        const int* value = map.Find(key);
+        const auto found = expected.find(key);
+
+        ASSERT_EQ(value != nullptr, found != expected.end()) << key;
+        if (value != nullptr) {
+            EXPECT_EQ(*value, found->second);
+        }
+    }
+
+    std::size_t visited = 0;
+    map.ForEach([&](const int& key, const int& value) {
+        EXPECT_EQ(expected.at(key), value);
+        ++visited;
+    });
+    EXPECT_EQ(visited, expected.size());
+}
+
+TEST(StaticHashMapTest, DestroysEntriesExactlyOnce)
+{
+    {
+        StaticHashMap<int, Tracked, 8, CollidingHash> map;
+
+        for (int i = 0; i < 8; ++i) {
+            ASSERT_TRUE(map.InsertOrAssign(i, Tracked(i)));
+        }
+
+        EXPECT_EQ(Tracked::GetLiveCount(), 8);
+
+        EXPECT_TRUE(map.Erase(0));
+        EXPECT_TRUE(map.Erase(4));
+        EXPECT_EQ(Tracked::GetLiveCount(), 6);
+
+        const StaticHashMap<int, Tracked, 8, CollidingHash> copy(map);
+        EXPECT_EQ(Tracked::GetLiveCount(), 12);
+        EXPECT_EQ(copy.Find(7)->GetValue(), 7);
+
+        map.Clear();
+        EXPECT_EQ(Tracked::GetLiveCount(), 6);
+    }
+
+    EXPECT_EQ(Tracked::GetLiveCount(), 0);
+}
+
+}
@@ -0,0 +1,198 @@
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "leakguard/staticpool.hpp"
+#include "tracked.hpp"
+
+namespace {
+
+using lg::NopMutexImpl;
+using lg::StaticPool;
+using lg::test::Tracked;
+
+using IntPool = StaticPool<int, 2>;
+
+/**
+ * @brief A MutexImpl over a std::mutex owned by the test
+ */
+struct StdMutexImpl {
+    std::mutex* mutex;
+
+    void Lock() { mutex->lock(); }
+    void Unlock() { mutex->unlock(); }
+};
+
+TEST(StaticPoolTest, AllocatesUpToCapacity)
+{
+    StaticPool<int, 3> pool;
+    std::set<int*> objects;
+
+    for (int i = 0; i < 3; ++i) {
+        int* object = pool.Allocate(i);
+        ASSERT_NE(object, nullptr);
+        EXPECT_EQ(*object, i);
+        EXPECT_TRUE(pool.Owns(object));
+        objects.insert(object);
+    }
+
+    EXPECT_EQ(objects.size(), 3);
+    EXPECT_TRUE(pool.IsFull());
+    EXPECT_EQ(pool.Allocate(3), nullptr);
+
+    EXPECT_TRUE(pool.Free(*objects.begin()));
+    EXPECT_FALSE(pool.IsFull());
+    EXPECT_EQ(pool.Allocate(4), *objects.begin());
+}
+
+TEST(StaticPoolTest, RejectsForeignPointers)
+{
+    IntPool pool;
+    int outside = 0;
+
+    EXPECT_FALSE(pool.Owns(&outside));
+    EXPECT_FALSE(pool.Free(&outside));
+    EXPECT_EQ(pool.GetHandle(&outside), IntPool::Handle {});
+    EXPECT_EQ(pool.Get(IntPool::Handle {}), nullptr);
+}
+
+TEST(StaticPoolTest, DetectsStaleHandles)
+{
+    StaticPool<int, 2> pool;
+
+    int* first = pool.Allocate(1);
+    const auto handle = pool.GetHandle(first);
+    EXPECT_EQ(pool.Get(handle), first);
+
+    ASSERT_TRUE(pool.Free(handle));
+    EXPECT_EQ(pool.Get(handle), nullptr);
+    EXPECT_FALSE(pool.Free(handle));
+
+    // The slot is reused, the old handle still must not reach the new object
+    int* second = pool.Allocate(2);
+    ASSERT_EQ(second, first);
+    EXPECT_EQ(pool.Get(handle), nullptr);
+    EXPECT_FALSE(pool.Free(handle));
+
+    const auto newHandle = pool.GetHandle(second);
+    EXPECT_NE(newHandle, handle);
+    EXPECT_EQ(pool.Get(newHandle), second);
+}
+
+TEST(StaticPoolTest, RejectsDoubleFrees)
+{
+    StaticPool<int, 2> pool;
+    int* object = pool.Allocate(1);
+
+    EXPECT_TRUE(pool.Free(object));
+    EXPECT_FALSE(pool.Free(object));
+    EXPECT_EQ(pool.GetSize(), 0);
+
+    // The free list must not contain the slot twice
+    int* first = pool.Allocate(2);
+    int* second = pool.Allocate(3);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(pool.Allocate(4), nullptr);
+}
+
+TEST(StaticPoolTest, InvalidatesHandlesOnClear)
+{
+    StaticPool<int, 2> pool;
+    const auto handle = pool.GetHandle(pool.Allocate(1));
+
+    pool.Clear();
+    EXPECT_TRUE(pool.IsEmpty());
+    EXPECT_EQ(pool.Get(handle), nullptr);
+
+    pool.Allocate(2);
+    EXPECT_EQ(pool.Get(handle), nullptr);
+}
+
+TEST(StaticPoolTest, ReturnsWhateverOccupiesTheSlotWithoutGenerations)
+{
+    StaticPool<int, 2, NopMutexImpl, false> pool;
+
+    int* first = pool.Allocate(1);
+    const auto handle = pool.GetHandle(first);
+    ASSERT_TRUE(pool.Free(first));
+
+    int* second = pool.Allocate(2);
+    ASSERT_EQ(second, first);
+    EXPECT_EQ(pool.Get(handle), second);
+}
+
+TEST(StaticPoolTest, DestroysObjectsExactlyOnce)
+{
+    {
+        StaticPool<Tracked, 4> pool;
+        std::array<Tracked*, 4> objects {};
+
+        for (int i = 0; i < 4; ++i) {
+            objects[static_cast<std::size_t>(i)] = pool.Allocate(i);
+        }
+
+        EXPECT_EQ(Tracked::GetLiveCount(), 4);
+        EXPECT_TRUE(pool.Free(objects[1]));
+        EXPECT_FALSE(pool.Free(objects[1]));
+        EXPECT_EQ(Tracked::GetLiveCount(), 3);
+
+        pool.Clear();
+        EXPECT_EQ(Tracked::GetLiveCount(), 0);
+
+        pool.Allocate(5);
+        pool.Allocate(6);
+    }
+
+    EXPECT_EQ(Tracked::GetLiveCount(), 0);
+
+    {
+        StaticPool<Tracked, 4, NopMutexImpl, false> pool;
+        Tracked* first = pool.Allocate(1);
+        pool.Allocate(2);
+        pool.Allocate(3);
+        ASSERT_TRUE(pool.Free(first));
+
+        pool.Clear();
+        EXPECT_EQ(Tracked::GetLiveCount(), 0);
+    }
+}
+
+TEST(StaticPoolThreadTest, RejectsConcurrentDoubleFrees)
+{
+    std::mutex mutex;
+    StaticPool<Tracked, 2, StdMutexImpl> pool(StdMutexImpl { &mutex });
+
+    for (int round = 0; round < 2000; ++round) {
+        Tracked* object = pool.Allocate(round);
+        ASSERT_NE(object, nullptr);
+
+        std::atomic<int> freed { 0 };
+        auto free = [&] {
+            if (pool.Free(object)) {
+                freed.fetch_add(1, std::memory_order_relaxed);
+            }
+        };
+
+        std::thread first(free);
+        std::thread second(free);
+        first.join();
+        second.join();
+
+        ASSERT_EQ(freed.load(), 1);
+        ASSERT_TRUE(pool.IsEmpty());
+        ASSERT_EQ(Tracked::GetLiveCount(), 0);
+    }
+
+    // The free list holds each slot once
+    EXPECT_NE(pool.Allocate(1), nullptr);
+    EXPECT_NE(pool.Allocate(2), nullptr);
+    EXPECT_EQ(pool.Allocate(3), nullptr);
+    pool.Clear();
+}
+
+}
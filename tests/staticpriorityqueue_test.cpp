@@ -0,0 +1,204 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "leakguard/staticpriorityqueue.hpp"
+
+namespace {
+
+using lg::StaticPriorityQueue;
+
+template <typename Queue>
+std::vector<int> PopAll(Queue& queue)
+{
+    std::vector<int> values;
+    int value = 0;
+    while (queue.PeekAndPop(value)) {
+        values.push_back(value);
+    }
+
+    return values;
+}
+
+TEST(StaticPriorityQueueTest, PopsInPriorityOrder)
+{
+    StaticPriorityQueue<int, 8> queue;
+    for (const int value : { 3, 1, 4, 1, 5, 9, 2, 6 }) {
+        EXPECT_NE(queue.Push(value), decltype(queue)::Handle {});
+    }
+
+    EXPECT_EQ(queue.Push(7), decltype(queue)::Handle {});
+    EXPECT_EQ(queue.Top(), 9);
+    EXPECT_EQ(PopAll(queue), (std::vector<int> { 9, 6, 5, 4, 3, 2, 1, 1 }));
+
+    int untouched = -1;
+    EXPECT_FALSE(queue.PeekAndPop(untouched));
+    EXPECT_EQ(untouched, -1);
+    EXPECT_FALSE(queue.Pop());
+
+    StaticPriorityQueue<int, 4, std::greater<int>> earliest;
+    earliest.Push(30);
+    earliest.Push(10);
+    earliest.Push(20);
+    EXPECT_EQ(PopAll(earliest), (std::vector<int> { 10, 20, 30 }));
+}
+
+TEST(StaticPriorityQueueTest, HandlesFollowTheirElements)
+{
+    StaticPriorityQueue<int, 16> queue;
+    std::array<decltype(queue)::Handle, 10> handles {};
+
+    for (int i = 0; i < 10; ++i) {
+        handles[static_cast<std::size_t>(i)] = queue.Push(i * 10);
+    }
+
+    EXPECT_EQ(queue.GetTopHandle(), handles[9]);
+    ASSERT_TRUE(queue.Pop());
+    ASSERT_TRUE(queue.Pop());
+    EXPECT_FALSE(queue.Contains(handles[9]));
+    EXPECT_FALSE(queue.Contains(handles[8]));
+    EXPECT_EQ(queue.Get(handles[9]), nullptr);
+
+    // New elements may take over the freed handles, the others stay put
+    const auto above = queue.Push(55);
+    const auto below = queue.Push(-5);
+    EXPECT_EQ(*queue.Get(above), 55);
+    EXPECT_EQ(*queue.Get(below), -5);
+    for (std::size_t i = 0; i < 8; ++i) {
+        ASSERT_TRUE(queue.Contains(handles[i]));
+        EXPECT_EQ(*queue.Get(handles[i]), static_cast<int>(i) * 10);
+    }
+
+    EXPECT_FALSE(queue.Contains({}));
+    EXPECT_EQ(queue.Get({}), nullptr);
+
+    queue.Clear();
+    EXPECT_FALSE(queue.Contains(handles[0]));
+    EXPECT_EQ(queue.GetTopHandle(), decltype(queue)::Handle {});
+}
+
+TEST(StaticPriorityQueueTest, ChangesPriorities)
+{
+    StaticPriorityQueue<int, 8> queue;
+    const auto low = queue.Push(1);
+    const auto middle = queue.Push(5);
+    const auto high = queue.Push(9);
+    queue.Push(3);
+
+    // DecreaseKey() only accepts a priority that is not lower
+    EXPECT_FALSE(queue.DecreaseKey(middle, 4));
+    EXPECT_EQ(*queue.Get(middle), 5);
+    EXPECT_TRUE(queue.DecreaseKey(low, 10));
+    EXPECT_EQ(queue.GetTopHandle(), low);
+
+    EXPECT_TRUE(queue.Update(low, 0));
+    EXPECT_EQ(queue.GetTopHandle(), high);
+    EXPECT_TRUE(queue.Update(middle, 20));
+    EXPECT_EQ(queue.GetTopHandle(), middle);
+
+    EXPECT_TRUE(queue.Remove(high));
+    EXPECT_FALSE(queue.Remove(high));
+    EXPECT_FALSE(queue.Update(high, 1));
+    EXPECT_FALSE(queue.DecreaseKey(high, 100));
+    EXPECT_EQ(PopAll(queue), (std::vector<int> { 20, 3, 0 }));
+}
+
+TEST(StaticPriorityQueueTest, HeapifiesWhatFits)
+{
+    StaticPriorityQueue<int, 8> queue;
+    queue.Push(100);
+
+    const std::array<int, 12> values { 7, 3, 11, 0, 5, 5, 2, 8, 99, 98, 97, 96 };
+    EXPECT_EQ(queue.Heapify(values.begin(), values.end()), 8);
+    EXPECT_EQ(queue.GetSize(), 8);
+    EXPECT_EQ(*queue.Get(queue.GetTopHandle()), 11);
+    EXPECT_EQ(PopAll(queue), (std::vector<int> { 11, 8, 7, 5, 5, 3, 2, 0 }));
+
+    EXPECT_EQ(queue.Heapify(values.begin(), values.begin()), 0);
+    EXPECT_TRUE(queue.IsEmpty());
+}
+
+template <std::size_t arity>
+void CompareWithReference()
+{
+    static constexpr std::size_t CAPACITY = 32;
+    using Queue = StaticPriorityQueue<int, CAPACITY, std::less<int>, arity>;
+
+    Queue queue;
+    std::vector<std::pair<typename Queue::Handle, int>> expected;
+    std::mt19937 random(arity);
+
+    for (int step = 0; step < 20000; ++step) {
+        const int value = static_cast<int>(random() % 64);
+        const std::size_t pick = expected.empty() ? 0 : random() % expected.size();
+
+        switch (random() % 6) {
+        case 0:
+        case 1: {
+            const auto handle = queue.Push(value);
+            if (expected.size() == CAPACITY) {
+                ASSERT_EQ(handle, typename Queue::Handle {});
+            } else {
+                ASSERT_TRUE(queue.Contains(handle));
+                expected.emplace_back(handle, value);
+            }
+            break;
+        }
+        case 2: {
+            const auto top = queue.GetTopHandle();
+            ASSERT_EQ(queue.Pop(), !expected.empty());
+            std::erase_if(expected, [top](const auto& entry) { return entry.first == top; });
+            break;
+        }
+        case 3:
+            if (!expected.empty()) {
+                ASSERT_TRUE(queue.Update(expected[pick].first, value));
+                expected[pick].second = value;
+            }
+            break;
+        case 4:
+            if (!expected.empty()) {
+                const bool raised = value >= expected[pick].second;
+                ASSERT_EQ(queue.DecreaseKey(expected[pick].first, value), raised);
+                if (raised) {
+                    expected[pick].second = value;
+                }
+            }
+            break;
+        default:
+            if (!expected.empty()) {
+                ASSERT_TRUE(queue.Remove(expected[pick].first));
+                ASSERT_FALSE(queue.Contains(expected[pick].first));
+                expected.erase(expected.begin() + static_cast<std::ptrdiff_t>(pick));
+            }
+            break;
+        }
+
+        ASSERT_EQ(queue.GetSize(), expected.size());
+        for (const auto& [handle, expectedValue] : expected) {
+            ASSERT_EQ(*queue.Get(handle), expectedValue);
+        }
+
+        if (!expected.empty()) {
+            const auto highest = std::ranges::max_element(
+                expected, {}, [](const auto& entry) { return entry.second; });
+            ASSERT_EQ(queue.Top(), highest->second);
+            ASSERT_EQ(*queue.Get(queue.GetTopHandle()), queue.Top());
+        }
+    }
+}
+
+TEST(StaticPriorityQueueTest, MatchesAReferenceModel)
+{
+    CompareWithReference<2>();
+    CompareWithReference<3>();
+    CompareWithReference<4>();
+}
+
+}
@@ -0,0 +1,99 @@
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "leakguard/staticsoavector.hpp"
+#include "tracked.hpp"
+
+namespace {
+
+using lg::StaticSoAVector;
+using lg::test::Tracked;
+
+template <typename Span>
+std::vector<typename Span::value_type> ToVector(Span span)
+{
+    return { span.begin(), span.end() };
+}
+
+TEST(StaticSoAVectorTest, StoresEachFieldContiguously)
+{
+    StaticSoAVector<4, std::uint8_t, double> vector;
+
+    EXPECT_TRUE(vector.IsEmpty());
+    EXPECT_TRUE(vector.GetField<0>().empty());
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(vector.Append(static_cast<std::uint8_t>(i), i * 0.5));
+    }
+
+    EXPECT_FALSE(vector.Append(std::uint8_t { 4 }, 2.0));
+    EXPECT_EQ(vector.GetSize(), 4);
+    EXPECT_EQ(ToVector(vector.GetField<0>()), (std::vector<std::uint8_t> { 0, 1, 2, 3 }));
+    EXPECT_EQ(ToVector(vector.GetField<1>()), (std::vector<double> { 0.0, 0.5, 1.0, 1.5 }));
+    EXPECT_EQ(std::get<1>(vector.GetRow(3)), 1.5);
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(vector.GetField<1>().data())
+            % lg::DEFAULT_CACHE_LINE_SIZE,
+        0);
+}
+
+TEST(StaticSoAVectorTest, RemovesRowsFromAllFields)
+{
+    StaticSoAVector<8, int, char> vector;
+
+    for (int i = 0; i < 5; ++i) {
+        vector.Append(i, static_cast<char>('a' + i));
+    }
+
+    EXPECT_TRUE(vector.RemoveIndex(1));
+    EXPECT_FALSE(vector.RemoveIndex(4));
+    EXPECT_EQ(ToVector(vector.GetField<0>()), (std::vector<int> { 0, 2, 3, 4 }));
+    EXPECT_EQ(ToVector(vector.GetField<1>()), (std::vector<char> { 'a', 'c', 'd', 'e' }));
+
+    EXPECT_TRUE(vector.SwapRemove(0));
+    EXPECT_FALSE(vector.SwapRemove(3));
+    EXPECT_EQ(ToVector(vector.GetField<0>()), (std::vector<int> { 4, 2, 3 }));
+    EXPECT_EQ(ToVector(vector.GetField<1>()), (std::vector<char> { 'e', 'c', 'd' }));
+
+    vector.Clear();
+    EXPECT_TRUE(vector.IsEmpty());
+    EXPECT_TRUE(vector.Append(7, 'x'));
+    EXPECT_EQ(std::get<0>(vector.GetRow(0)), 7);
+}
+
+TEST(StaticSoAVectorTest, DestroysValuesExactlyOnce)
+{
+    {
+        StaticSoAVector<4, Tracked, int> vector;
+
+        for (int i = 0; i < 4; ++i) {
+            vector.Append(Tracked(i), i);
+        }
+
+        EXPECT_EQ(Tracked::GetLiveCount(), 4);
+        vector.RemoveIndex(0);
+        vector.SwapRemove(0);
+        EXPECT_EQ(Tracked::GetLiveCount(), 2);
+
+        StaticSoAVector<4, Tracked, int> copy(vector);
+        EXPECT_EQ(Tracked::GetLiveCount(), 4);
+
+        const StaticSoAVector<4, Tracked, int> moved(std::move(vector));
+        EXPECT_TRUE(vector.IsEmpty());
+        EXPECT_EQ(Tracked::GetLiveCount(), 4);
+        EXPECT_EQ(moved.GetField<0>()[0].GetValue(), 3);
+
+        copy = moved;
+        EXPECT_EQ(Tracked::GetLiveCount(), 4);
+        copy.Clear();
+        EXPECT_EQ(Tracked::GetLiveCount(), 2);
+    }
+
+    EXPECT_EQ(Tracked::GetLiveCount(), 0);
+}
+
+}
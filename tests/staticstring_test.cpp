@@ -0,0 +1,206 @@
+#include <charconv>
+#include <compare>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "leakguard/staticstring.hpp"
+
+namespace {
+
+using lg::StaticString;
+
+TEST(StaticStringMoveTest, TakesOverTheContents)
+{
+    StaticString<8> source("abc");
+    StaticString<8> moved(std::move(source));
+
+    EXPECT_STREQ(moved.ToCStr(), "abc");
+    EXPECT_TRUE(source.IsEmpty()); // NOLINT(bugprone-use-after-move)
+    EXPECT_STREQ(source.ToCStr(), "");
+
+    StaticString<8> assigned("xyz12345");
+    assigned = std::move(moved);
+    EXPECT_STREQ(assigned.ToCStr(), "abc");
+    EXPECT_TRUE(moved.IsEmpty()); // NOLINT(bugprone-use-after-move)
+}
+
+TEST(StaticStringSizeTest, StoresTheLengthInTheSmallestType)
+{
+    static_assert(sizeof(StaticString<15>) == 15 + 1 + sizeof(std::uint8_t));
+    static_assert(sizeof(StaticString<255>) == 255 + 1 + sizeof(std::uint8_t));
+
+    StaticString<255> string;
+    for (int i = 0; i < 300; ++i) {
+        string += 'x';
+    }
+
+    EXPECT_EQ(string.GetSize(), 255);
+    EXPECT_EQ(string.ToCStr()[255], '\0');
+}
+
+template <typename T>
+concept CAN_APPEND_NUMBER = requires(StaticString<8> string, T value) {
+    string.AppendNumber(value);
+    string.AppendHex(value);
+};
+
+static_assert(CAN_APPEND_NUMBER<int>);
+static_assert(CAN_APPEND_NUMBER<char>);
+static_assert(!CAN_APPEND_NUMBER<bool>);
+
+TEST(StaticStringNumberTest, PadsToTheWidth)
+{
+    StaticString<32> string;
+
+    EXPECT_TRUE(string.AppendNumber(42, 10, 5));
+    EXPECT_STREQ(string.ToCStr(), "   42");
+
+    string.Clear();
+    EXPECT_TRUE(string.AppendNumber(-42, 10, 6, '0'));
+    EXPECT_STREQ(string.ToCStr(), "-00042");
+
+    string.Clear();
+    EXPECT_TRUE(string.AppendNumber(-42, 10, 6, '*'));
+    EXPECT_STREQ(string.ToCStr(), "***-42");
+
+    string.Clear();
+    EXPECT_TRUE(string.AppendNumber(12345, 10, 3));
+    EXPECT_STREQ(string.ToCStr(), "12345");
+
+    string.Clear();
+    EXPECT_TRUE(string.AppendNumber(5U, 2, 8, '0'));
+    EXPECT_TRUE(string.AppendNumber(' ', 36));
+    EXPECT_STREQ(string.ToCStr(), "00000101w");
+
+    string.Clear();
+    EXPECT_TRUE(string.AppendHex(0x2A, 4));
+    EXPECT_TRUE(string.AppendHex(std::int8_t { -1 }));
+    EXPECT_TRUE(string.AppendHex(0xDEADBEEFU));
+    EXPECT_STREQ(string.ToCStr(), "002affdeadbeef");
+}
+
+TEST(StaticStringNumberTest, WritesTheExtremes)
+{
+    StaticString<32> string;
+
+    EXPECT_TRUE(string.AppendNumber(std::numeric_limits<int>::min()));
+    EXPECT_STREQ(string.ToCStr(), "-2147483648");
+
+    string.Clear();
+    EXPECT_TRUE(string.AppendNumber(std::numeric_limits<std::int8_t>::min()));
+    EXPECT_STREQ(string.ToCStr(), "-128");
+
+    string.Clear();
+    EXPECT_TRUE(string.AppendNumber(std::numeric_limits<std::int64_t>::min()));
+    EXPECT_STREQ(string.ToCStr(), "-9223372036854775808");
+
+    string.Clear();
+    EXPECT_TRUE(string.AppendNumber(std::numeric_limits<std::uint64_t>::max()));
+    EXPECT_STREQ(string.ToCStr(), "18446744073709551615");
+
+    string.Clear();
+    EXPECT_TRUE(string.AppendNumber(0));
+    EXPECT_TRUE(string.AppendHex(0));
+    EXPECT_STREQ(string.ToCStr(), "00");
+}
+
+TEST(StaticStringNumberTest, LeavesTheStringUnchangedOnOverflow)
+{
+    StaticString<4> string("ab");
+
+    EXPECT_FALSE(string.AppendNumber(123));
+    EXPECT_FALSE(string.AppendNumber(-12));
+    EXPECT_FALSE(string.AppendNumber(1, 10, 3));
+    EXPECT_FALSE(string.AppendNumber(1, 37));
+    EXPECT_FALSE(string.AppendHex(0x123));
+    EXPECT_FALSE(string.AppendFloat(0.125));
+    EXPECT_FALSE(string.AppendFloat(1.5, std::chars_format::fixed, 2));
+    EXPECT_STREQ(string.ToCStr(), "ab");
+    EXPECT_EQ(string.GetSize(), 2);
+
+    EXPECT_TRUE(string.AppendNumber(-1));
+    EXPECT_STREQ(string.ToCStr(), "ab-1");
+    EXPECT_FALSE(string.AppendNumber(0));
+    EXPECT_STREQ(string.ToCStr(), "ab-1");
+}
+
+TEST(StaticStringNumberTest, WritesFloats)
+{
+    StaticString<32> string;
+
+    EXPECT_TRUE(string.AppendFloat(0.1));
+    EXPECT_STREQ(string.ToCStr(), "0.1");
+
+    string.Clear();
+    EXPECT_TRUE(string.AppendFloat(3.14159, std::chars_format::fixed, 2));
+    EXPECT_STREQ(string.ToCStr(), "3.14");
+
+    string.Clear();
+    EXPECT_TRUE(string.AppendFloat(1500.0F, std::chars_format::scientific, 1));
+    EXPECT_STREQ(string.ToCStr(), "1.5e+03");
+}
+
+// Every capacity forwards to the same StaticStringBase functions, so
+// the strings below mix capacities on purpose
+
+TEST(StaticStringTest, TruncatesAtTheCapacity)
+{
+    StaticString<4> string("ab");
+    string += StaticString<16>("cdef");
+    EXPECT_STREQ(string.ToCStr(), "abcd");
+    EXPECT_EQ(std::strlen(string.ToCStr()), string.GetSize());
+
+    string = StaticString<16>("0123456789");
+    EXPECT_STREQ(string.ToCStr(), "0123");
+
+    string = "xy";
+    string.Append("zzzz", 1);
+    string += '!';
+    string += '?';
+    EXPECT_STREQ(string.ToCStr(), "xyz!");
+
+    const StaticString<3> constructed(StaticString<8>("abcdef"));
+    EXPECT_STREQ(constructed.ToCStr(), "abc");
+}
+
+TEST(StaticStringTest, ComparesAcrossCapacities)
+{
+    const StaticString<4> abc("abc");
+
+    EXPECT_EQ(abc, StaticString<16>("abc"));
+    EXPECT_NE(abc, StaticString<16>("abcd"));
+    EXPECT_EQ(abc <=> StaticString<16>("abd"), std::strong_ordering::less);
+    EXPECT_EQ(abc <=> StaticString<2>("ab"), std::strong_ordering::greater);
+    EXPECT_EQ(StaticString<4>() <=> StaticString<8>(), std::strong_ordering::equal);
+
+    EXPECT_TRUE(abc.StartsWith(StaticString<8>("ab")));
+    EXPECT_TRUE(abc.StartsWith(StaticString<8>()));
+    EXPECT_FALSE(abc.StartsWith(StaticString<8>("abcd")));
+    EXPECT_TRUE(abc.EndsWith(StaticString<8>("bc")));
+    EXPECT_FALSE(abc.EndsWith(StaticString<8>("ab")));
+}
+
+TEST(StaticStringTest, SkipsAndTruncates)
+{
+    StaticString<16> string("hello world");
+
+    EXPECT_TRUE(string.Skip(6));
+    EXPECT_STREQ(string.ToCStr(), "world");
+    EXPECT_FALSE(string.Skip(6));
+    EXPECT_STREQ(string.ToCStr(), "world");
+
+    EXPECT_TRUE(string.Truncate(3));
+    EXPECT_STREQ(string.ToCStr(), "wor");
+    EXPECT_FALSE(string.Truncate(4));
+
+    EXPECT_TRUE(string.Skip(3));
+    EXPECT_TRUE(string.IsEmpty());
+    EXPECT_STREQ(string.ToCStr(), "");
+}
+
+}
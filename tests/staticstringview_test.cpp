@@ -0,0 +1,62 @@
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "leakguard/staticstringview.hpp"
+
+namespace {
+
+using lg::StaticStringTokens;
+using lg::StaticStringView;
+
+std::vector<std::string_view> PartsOf(const StaticStringTokens& tokens)
+{
+    std::vector<std::string_view> parts;
+    for (const StaticStringView part : tokens) {
+        parts.push_back(part.ToStringView());
+    }
+
+    return parts;
+}
+
+TEST(StaticStringViewTest, SplitsIntoEmptyFields)
+{
+    using Parts = std::vector<std::string_view>;
+
+    EXPECT_EQ(PartsOf(StaticStringView("a,b,c").Split(',')), (Parts { "a", "b", "c" }));
+    EXPECT_EQ(PartsOf(StaticStringView("a,,b").Split(',')), (Parts { "a", "", "b" }));
+    EXPECT_EQ(PartsOf(StaticStringView(",a,").Split(',')), (Parts { "", "a", "" }));
+    EXPECT_EQ(PartsOf(StaticStringView(",,").Split(',')), (Parts { "", "", "" }));
+    EXPECT_EQ(PartsOf(StaticStringView("abc").Split(',')), (Parts { "abc" }));
+    EXPECT_EQ(PartsOf(StaticStringView("").Split(',')), (Parts { "" }));
+}
+
+TEST(StaticStringViewTest, TokenizesOverRunsOfDelimiters)
+{
+    using Parts = std::vector<std::string_view>;
+
+    EXPECT_EQ(PartsOf(StaticStringView(" a  b ").Tokenize(" ")), (Parts { "a", "b" }));
+    EXPECT_EQ(PartsOf(StaticStringView("x=1;\t y=2").Tokenize("; \t")), (Parts { "x=1", "y=2" }));
+    EXPECT_EQ(PartsOf(StaticStringView("abc").Tokenize(" ")), (Parts { "abc" }));
+    EXPECT_EQ(PartsOf(StaticStringView(" \t ").Tokenize(" \t")), Parts {});
+    EXPECT_EQ(PartsOf(StaticStringView("").Tokenize(" ")), Parts {});
+}
+
+TEST(StaticStringViewTest, PartsViewTheOriginalCharacters)
+{
+    const std::string text = "key:value";
+    const StaticStringView view(text);
+
+    auto parts = view.Split(':').begin();
+    EXPECT_EQ(parts->GetDataPtr(), text.data());
+    ++parts;
+    EXPECT_EQ(parts->GetDataPtr(), text.data() + 4);
+    EXPECT_EQ(parts->GetSize(), 5);
+    ++parts;
+    EXPECT_TRUE(parts == std::default_sentinel);
+}
+
+}
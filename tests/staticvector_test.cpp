@@ -0,0 +1,340 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "leakguard/staticvector.hpp"
+#include "tracked.hpp"
+
+namespace {
+
+using lg::StaticVector;
+using lg::test::Tracked;
+
+/**
+ * @brief Gets the values of all the elements, to compare them at once
+ */
+template <typename Vector>
+std::vector<int> ValuesOf(const Vector& vector)
+{
+    std::vector<int> values;
+
+    for (const Tracked& element : vector) {
+        values.push_back(element.GetValue());
+    }
+
+    return values;
+}
+
+TEST(StaticVectorLifetimeTest, ConstructsOnlyTheStoredElements)
+{
+    {
+        StaticVector<Tracked, 4> vector;
+        EXPECT_EQ(Tracked::GetLiveCount(), 0);
+
+        ASSERT_TRUE(vector.EmplaceBack(1));
+        ASSERT_TRUE(vector.Append(Tracked(2)));
+        const Tracked three(3);
+        ASSERT_TRUE(vector.Append(three));
+        EXPECT_EQ(Tracked::GetLiveCount(), 4);
+
+        vector.Clear();
+        EXPECT_EQ(Tracked::GetLiveCount(), 1);
+
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_TRUE(vector.EmplaceBack(i));
+        }
+
+        EXPECT_FALSE(vector.EmplaceBack(4));
+        EXPECT_FALSE(vector.Append(Tracked(5)));
+        EXPECT_EQ(vector.GetSize(), 4);
+        EXPECT_EQ(ValuesOf(vector), (std::vector<int> { 0, 1, 2, 3 }));
+        EXPECT_EQ(Tracked::GetLiveCount(), 5);
+    }
+
+    EXPECT_EQ(Tracked::GetLiveCount(), 0);
+}
+
+TEST(StaticVectorMoveTest, MovesElementsAndEmptiesTheSource)
+{
+    {
+        StaticVector<Tracked, 4> source;
+        for (int i = 0; i < 3; ++i) {
+            source.EmplaceBack(i);
+        }
+
+        StaticVector<Tracked, 4> moved(std::move(source));
+        EXPECT_TRUE(source.IsEmpty()); // NOLINT(bugprone-use-after-move)
+        EXPECT_EQ(ValuesOf(moved), (std::vector<int> { 0, 1, 2 }));
+        EXPECT_EQ(Tracked::GetLiveCount(), 3);
+
+        StaticVector<Tracked, 4> assigned;
+        assigned.EmplaceBack(7);
+        assigned = std::move(moved);
+        EXPECT_TRUE(moved.IsEmpty()); // NOLINT(bugprone-use-after-move)
+        EXPECT_EQ(ValuesOf(assigned), (std::vector<int> { 0, 1, 2 }));
+        EXPECT_EQ(Tracked::GetLiveCount(), 3);
+
+        // Copies into a smaller vector keep the first elements
+        const StaticVector<Tracked, 2> copied(assigned);
+        EXPECT_EQ(ValuesOf(copied), (std::vector<int> { 0, 1 }));
+        EXPECT_EQ(Tracked::GetLiveCount(), 5);
+
+        assigned = copied;
+        EXPECT_EQ(ValuesOf(assigned), (std::vector<int> { 0, 1 }));
+        EXPECT_EQ(Tracked::GetLiveCount(), 4);
+    }
+
+    EXPECT_EQ(Tracked::GetLiveCount(), 0);
+}
+
+TEST(StaticVectorLifetimeTest, ShiftsElementsWithoutLeaks)
+{
+    {
+        StaticVector<Tracked, 8> vector;
+        for (int i = 0; i < 4; ++i) {
+            vector.EmplaceBack(i);
+        }
+
+        ASSERT_TRUE(vector.Insert(1, Tracked(10)));
+        const std::vector<Tracked> range { Tracked(20), Tracked(21), Tracked(22), Tracked(23) };
+        EXPECT_EQ(vector.InsertRange(0, range.begin(), range.end()), 3);
+        EXPECT_EQ(ValuesOf(vector), (std::vector<int> { 20, 21, 22, 0, 10, 1, 2, 3 }));
+        EXPECT_EQ(Tracked::GetLiveCount(), 8 + 4);
+
+        EXPECT_TRUE(vector.EraseRange(2, 5));
+        EXPECT_TRUE(vector.RemoveIndex(0));
+        EXPECT_FALSE(vector.EraseRange(3, 2));
+        EXPECT_FALSE(vector.RemoveIndex(4));
+        EXPECT_EQ(ValuesOf(vector), (std::vector<int> { 21, 1, 2, 3 }));
+        EXPECT_EQ(Tracked::GetLiveCount(), 4 + 4);
+    }
+
+    EXPECT_EQ(Tracked::GetLiveCount(), 0);
+}
+
+TEST(StaticVectorLifetimeTest, RemovesElementsWithoutLeaks)
+{
+    {
+        StaticVector<Tracked, 8> vector;
+        for (int i = 0; i < 8; ++i) {
+            vector.EmplaceBack(i);
+        }
+
+        EXPECT_TRUE(vector.SwapRemove(1));
+        EXPECT_TRUE(vector.SwapRemove(6));
+        EXPECT_FALSE(vector.SwapRemove(6));
+        EXPECT_EQ(ValuesOf(vector), (std::vector<int> { 0, 7, 2, 3, 4, 5 }));
+        EXPECT_EQ(Tracked::GetLiveCount(), 6);
+
+        std::size_t calls = 0;
+        EXPECT_EQ(vector.RemoveIf([&calls](const Tracked& element) {
+            ++calls;
+            return element.GetValue() % 2 == 1;
+        }),
+            3);
+        EXPECT_EQ(calls, 6);
+        EXPECT_EQ(ValuesOf(vector), (std::vector<int> { 0, 2, 4 }));
+        EXPECT_EQ(Tracked::GetLiveCount(), 3);
+
+        EXPECT_EQ(vector.RemoveValue(Tracked(2)), 1);
+        EXPECT_EQ(ValuesOf(vector), (std::vector<int> { 0, 4 }));
+        EXPECT_EQ(Tracked::GetLiveCount(), 2);
+    }
+
+    EXPECT_EQ(Tracked::GetLiveCount(), 0);
+}
+
+template <typename T>
+class StaticVectorModelTest : public testing::Test { };
+
+// Trivially copyable elements are shifted with memmove(), others one by one
+using ModelTypes = testing::Types<int, std::string>;
+
+TYPED_TEST_SUITE(StaticVectorModelTest, ModelTypes);
+
+template <typename T>
+T MakeValue(int key)
+{
+    if constexpr (std::is_same_v<T, std::string>) {
+        // Long enough not to fit in the small string buffer
+        return std::string(24, static_cast<char>('a' + key)) + std::to_string(key);
+    } else {
+        return key;
+    }
+}
+
+TYPED_TEST(StaticVectorModelTest, MatchesStdVector)
+{
+    static constexpr std::size_t CAPACITY = 24;
+    static constexpr unsigned OPERATIONS = 7;
+
+    StaticVector<TypeParam, CAPACITY> vector;
+    std::vector<TypeParam> expected;
+    std::mt19937 random(1234);
+
+    for (int step = 0; step < 20000; ++step) {
+        const std::size_t size = expected.size();
+        const auto value = MakeValue<TypeParam>(static_cast<int>(random() % 8));
+        const std::size_t index = random() % (size + 3);
+
+        switch (random() % OPERATIONS) {
+        case 0:
+            ASSERT_EQ(vector.Append(value), size < CAPACITY);
+            if (size < CAPACITY) {
+                expected.push_back(value);
+            }
+            break;
+        case 1:
+            ASSERT_EQ(vector.Insert(index, value), size < CAPACITY);
+            if (size < CAPACITY) {
+                expected.insert(expected.begin() + static_cast<std::ptrdiff_t>(std::min(index, size)), value);
+            }
+            break;
+        case 2: {
+            std::vector<TypeParam> range(random() % 6);
+            for (auto& element : range) {
+                element = MakeValue<TypeParam>(static_cast<int>(random() % 8));
+            }
+
+            const std::size_t count = std::min(CAPACITY - size, range.size());
+            ASSERT_EQ(vector.InsertRange(index, range.begin(), range.end()), count);
+            expected.insert(expected.begin() + static_cast<std::ptrdiff_t>(std::min(index, size)),
+                range.begin(), range.begin() + static_cast<std::ptrdiff_t>(count));
+            break;
+        }
+        case 3: {
+            const std::size_t last = random() % (size + 2);
+            const bool valid = index <= last && last <= size;
+
+            ASSERT_EQ(vector.EraseRange(index, last), valid);
+            if (valid) {
+                expected.erase(expected.begin() + static_cast<std::ptrdiff_t>(index),
+                    expected.begin() + static_cast<std::ptrdiff_t>(last));
+            }
+            break;
+        }
+        case 4:
+            ASSERT_EQ(vector.RemoveIndex(index), index < size);
+            if (index < size) {
+                expected.erase(expected.begin() + static_cast<std::ptrdiff_t>(index));
+            }
+            break;
+        case 5:
+            ASSERT_EQ(vector.SwapRemove(index), index < size);
+            if (index < size) {
+                expected[index] = std::move(expected.back());
+                expected.pop_back();
+            }
+            break;
+        case 6:
+            ASSERT_EQ(vector.RemoveValue(value), std::erase(expected, value));
+            break;
+        default:
+            break;
+        }
+
+        ASSERT_TRUE(std::ranges::equal(vector, expected)) << "step " << step;
+    }
+}
+
+/**
+ * @brief Exercises the mutating operations during constant evaluation
+ */
+consteval StaticVector<int, 8> BuildTable()
+{
+    StaticVector<int, 8> table;
+    const int values[] = { 1, 2, 3, 4, 5 }; // NOLINT(*-avoid-c-arrays)
+
+    table.AppendRange(values, values + 5);
+    table.Insert(0, 0);
+    table.EraseRange(2, 4);
+    table.SwapRemove(0);
+    table.RemoveIf([](int value) { return value == 1; });
+    table.EmplaceBack(6);
+
+    return table;
+}
+
+TEST(StaticVectorConstexprTest, BuildsTablesAtCompileTime)
+{
+    static constexpr auto TABLE = BuildTable();
+    static_assert(TABLE.GetSize() == 3);
+    static_assert(TABLE[0] == 5 && TABLE[1] == 4 && TABLE[2] == 6);
+
+    static constexpr auto PRIMES = lg::VEC({ 2, 3, 5, 7 });
+    static_assert(PRIMES.GetCapacity() == 4 && PRIMES.GetSize() == 4);
+    static_assert(PRIMES[3] == 7);
+
+    EXPECT_EQ(std::vector<int>(TABLE.begin(), TABLE.end()), (std::vector<int> { 5, 4, 6 }));
+}
+
+TEST(StaticVectorSizeTest, StoresTheSizeInTheSmallestType)
+{
+    static_assert(std::is_same_v<lg::MinimalSizeType<255>, std::uint8_t>);
+    static_assert(std::is_same_v<lg::MinimalSizeType<256>, std::uint16_t>);
+    static_assert(std::is_same_v<lg::MinimalSizeType<65535>, std::uint16_t>);
+    static_assert(std::is_same_v<lg::MinimalSizeType<65536>, std::uint32_t>);
+    static_assert(std::is_same_v<lg::MinimalSizeType<(std::size_t { 1 } << 32)>, std::size_t>);
+
+    static_assert(sizeof(StaticVector<std::uint8_t, 15>) == 16);
+    static_assert(sizeof(StaticVector<std::uint8_t, 255>) == 256);
+
+    // The largest size of a narrow type is still reachable
+    StaticVector<std::uint8_t, 255> vector;
+    for (std::size_t i = 0; i < 255; ++i) {
+        ASSERT_TRUE(vector.Append(static_cast<std::uint8_t>(i)));
+    }
+
+    EXPECT_FALSE(vector.Append(0));
+    EXPECT_EQ(vector.GetSize(), 255);
+    EXPECT_EQ(vector[254], 254);
+
+    EXPECT_TRUE(vector.EraseRange(0, 255));
+    EXPECT_TRUE(vector.IsEmpty());
+}
+
+// The copies below go through the StaticVectorBase helpers shared by
+// every capacity of an element type
+
+TEST(StaticVectorCopyTest, CopiesAcrossCapacitiesAndTypes)
+{
+    StaticVector<int, 8> source;
+    for (int i = 1; i <= 5; ++i) {
+        source.Append(i);
+    }
+
+    const StaticVector<long, 3> narrow(source);
+    EXPECT_EQ(std::vector<long>(narrow.begin(), narrow.end()), (std::vector<long> { 1, 2, 3 }));
+
+    StaticVector<int, 16> wide;
+    wide.Append(9);
+    wide = source;
+    EXPECT_TRUE(std::ranges::equal(wide, source));
+
+    const auto& same = wide;
+    wide = same;
+    EXPECT_TRUE(std::ranges::equal(wide, source));
+
+    {
+        StaticVector<Tracked, 4> tracked;
+        tracked.EmplaceBack(0);
+        tracked = source;
+        EXPECT_EQ(ValuesOf(tracked), (std::vector<int> { 1, 2, 3, 4 }));
+        EXPECT_EQ(Tracked::GetLiveCount(), 4);
+
+        const StaticVector<Tracked, 2> copied(tracked);
+        EXPECT_EQ(ValuesOf(copied), (std::vector<int> { 1, 2 }));
+        EXPECT_EQ(Tracked::GetLiveCount(), 6);
+    }
+
+    EXPECT_EQ(Tracked::GetLiveCount(), 0);
+}
+
+}
@@ -0,0 +1,62 @@
+#include <cstddef>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "leakguard/staticstring.hpp"
+#include "leakguard/staticstringview.hpp"
+
+namespace {
+
+using lg::SEARCH_NPOS;
+using lg::StaticString;
+using lg::StaticStringView;
+
+// Longer than a single SSE2 or SWAR chunk, with matches on both sides
+// of the chunk boundaries
+const std::string TEXT = "abcabcabc--xyz--abcabcabc-xyzxyz-abcab";
+
+TEST(StringSearchTest, MatchesStdStringFromEveryPosition)
+{
+    for (const std::string needle : { "a", "abc", "xyz", "cab", "-x", "zz", "" }) {
+        for (std::size_t position = 0; position <= TEXT.size() + 1; ++position) {
+            const std::size_t expected = TEXT.find(needle, position);
+            const std::size_t found = lg::FindSubstringFrom(
+                TEXT.data(), TEXT.size(), needle.data(), needle.size(), position);
+
+            ASSERT_EQ(found, expected == std::string::npos ? SEARCH_NPOS : expected)
+                << '"' << needle << "\" at " << position;
+        }
+    }
+
+    for (std::size_t position = 0; position <= TEXT.size(); ++position) {
+        const std::size_t expected = TEXT.find_first_of("yb", position);
+        ASSERT_EQ(lg::FindFirstOfFrom(TEXT.data(), TEXT.size(), "yb", 2, position),
+            expected == std::string::npos ? SEARCH_NPOS : expected);
+        ASSERT_EQ(lg::FindCharFrom(TEXT.data(), TEXT.size(), 'z', position),
+            TEXT.find('z', position) == std::string::npos ? SEARCH_NPOS : TEXT.find('z', position));
+    }
+}
+
+TEST(StringSearchTest, CountsNonOverlappingOccurrences)
+{
+    EXPECT_EQ(lg::CountSubstrings("aaaaa", 5, "aa", 2), 2);
+    EXPECT_EQ(lg::CountSubstrings("aaaaa", 5, "", 0), 0);
+    EXPECT_EQ(lg::CountSubstrings(TEXT.data(), TEXT.size(), "abc", 3), 7);
+}
+
+TEST(StringSearchTest, StringsAndViewsAgree)
+{
+    const StaticString<64> string(TEXT.c_str());
+    const StaticStringView view(string);
+
+    EXPECT_EQ(string.Find('x', 12), view.Find('x', 12));
+    EXPECT_EQ(string.Find(StaticString<8>("abc"), 1), view.Find("abc", 1));
+    EXPECT_EQ(string.FindFirstOf(StaticString<8>("zy")), view.FindFirstOf("zy"));
+    EXPECT_EQ(string.Count(StaticString<8>("xyz")), 3);
+    EXPECT_EQ(view.Count("xyz"), 3);
+    EXPECT_EQ(view.Find("nope"), StaticStringView::NPOS);
+    EXPECT_EQ(string.Find('q'), StaticString<64>::NPOS);
+}
+
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+namespace lg::test {
+
+/**
+ * @brief A value type counting its live instances, to check that containers
+ *        construct and destroy their elements exactly once
+ *
+ * It has no default constructor, so containers storing it must not
+ * construct elements before they are added.
+ */
+class Tracked {
+public:
+    explicit Tracked(int value) noexcept
+        : m_value(value)
+    {
+        ++s_live;
+    }
+
+    Tracked(const Tracked& other) noexcept
+        : m_value(other.m_value)
+    {
+        ++s_live;
+    }
+
+    Tracked(Tracked&& other) noexcept
+        : m_value(other.m_value)
+    {
+        other.m_value = MOVED_FROM;
+        ++s_live;
+    }
+
+    Tracked& operator=(const Tracked& other) noexcept = default;
+
+    Tracked& operator=(Tracked&& other) noexcept
+    {
+        m_value = other.m_value;
+        other.m_value = MOVED_FROM;
+        return *this;
+    }
+
+    ~Tracked() noexcept
+    {
+        --s_live;
+    }
+
+    [[nodiscard]] int GetValue() const noexcept
+    {
+        return m_value;
+    }
+
+    bool operator==(const Tracked& other) const noexcept = default;
+
+    /**
+     * @brief Gets the number of instances currently alive
+     */
+    [[nodiscard]] static int GetLiveCount() noexcept
+    {
+        return s_live;
+    }
+
+    /**
+     * @brief The value left behind in a moved-from instance
+     */
+    static constexpr int MOVED_FROM = -1;
+
+private:
+    int m_value;
+
+    inline static int s_live = 0;
+};
+
+};